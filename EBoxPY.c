@@ -3,6 +3,9 @@
 #include <Windows.h>
 #include <Psapi.h>
 #include <Tlhelp32.h>
+#include <emmintrin.h>
+#include <intrin.h>
+#include <ctype.h>
 
 /*
  *
@@ -12,6 +15,169 @@
 
 #define EBOXPY_OBJECT_ZERO(T, O) memset((void*)((char*)O + sizeof(PyObject)), 0, sizeof(T) - sizeof(PyObject))
 
+#define EBOXPY_PARALLEL_MAXIMUM 32
+
+// Runs _Routine once per context on its own Thread, falling back to the calling Thread when one cannot be created.
+static void _EBoxPY_Parallel(unsigned long _Count, LPTHREAD_START_ROUTINE _Routine, void* _Contexts, unsigned long long _Stride) {
+	HANDLE threads[EBOXPY_PARALLEL_MAXIMUM] = {0};
+	if (_Count > EBOXPY_PARALLEL_MAXIMUM)
+		_Count = EBOXPY_PARALLEL_MAXIMUM;
+	for (unsigned long i = 1; i < _Count; ++i)
+		threads[i] = CreateThread(NULL, 0, _Routine, (char*)_Contexts + i * _Stride, 0, NULL);
+	_Routine(_Contexts);
+	for (unsigned long i = 1; i < _Count; ++i) {
+		if (threads[i]) {
+			WaitForSingleObject(threads[i], INFINITE);
+			CloseHandle(threads[i]);
+		}
+		else {
+			_Routine((char*)_Contexts + i * _Stride);
+		}
+	}
+}
+
+static unsigned long _EBoxPY_Parallel_Count(void) {
+	SYSTEM_INFO information;
+	GetSystemInfo(&information);
+	if (information.dwNumberOfProcessors < 1)
+		return 1;
+	return (information.dwNumberOfProcessors > EBOXPY_PARALLEL_MAXIMUM ? EBOXPY_PARALLEL_MAXIMUM : (unsigned long)information.dwNumberOfProcessors);
+}
+
+typedef struct _EBoxPY_Ranges_T {
+	unsigned long long* Data_;
+	unsigned long long Count_;
+	unsigned long long Capacity_;
+	char Failed_;
+} _EBoxPY_Ranges, *_PEBoxPY_Ranges;
+
+// Appends [_Start, _End), extending the last Range instead when the two touch.
+static void _EBoxPY_Ranges_Add(_PEBoxPY_Ranges _Ranges, unsigned long long _Start, unsigned long long _End) {
+	if (_Ranges->Count_ && _Ranges->Data_[2 * _Ranges->Count_ - 1] == _Start) {
+		_Ranges->Data_[2 * _Ranges->Count_ - 1] = _End;
+		return;
+	}
+	if (_Ranges->Count_ == _Ranges->Capacity_) {
+		unsigned long long capacity = (_Ranges->Capacity_ ? _Ranges->Capacity_ * 2 : 16);
+		unsigned long long* data = (unsigned long long*)realloc(_Ranges->Data_, capacity * 2 * sizeof(unsigned long long));
+		if (!data) {
+			_Ranges->Failed_ = 1;
+			return;
+		}
+		_Ranges->Data_ = data;
+		_Ranges->Capacity_ = capacity;
+	}
+	_Ranges->Data_[2 * _Ranges->Count_] = _Start;
+	_Ranges->Data_[2 * _Ranges->Count_ + 1] = _End;
+	++_Ranges->Count_;
+}
+
+static void _EBoxPY_Ranges_Free(_PEBoxPY_Ranges _Ranges) {
+	free(_Ranges->Data_);
+	memset(_Ranges, 0, sizeof(_EBoxPY_Ranges));
+}
+
+// [ (Address, Size), ... ]
+static PyObject* _EBoxPY_Ranges_List(_PEBoxPY_Ranges _Ranges) {
+	PyObject* output = PyList_New((Py_ssize_t)_Ranges->Count_);
+	if (!output)
+		return NULL;
+	for (unsigned long long i = 0; i < _Ranges->Count_; ++i) {
+		PyObject* range = Py_BuildValue("(KK)", _Ranges->Data_[2 * i], _Ranges->Data_[2 * i + 1] - _Ranges->Data_[2 * i]);
+		if (!range) {
+			Py_DECREF(output);
+			return NULL;
+		}
+		PyList_SET_ITEM(output, (Py_ssize_t)i, range);
+	}
+	return output;
+}
+
+// Collects the differing byte Ranges between _Left and _Right, offset by _Base, 16 bytes at a time.
+static void _EBoxPY_Compare(const unsigned char* _Left, const unsigned char* _Right, unsigned long long _Size, unsigned long long _Base, _PEBoxPY_Ranges _Ranges) {
+	unsigned long long i = 0;
+	for (; i + 16 <= _Size; i += 16) {
+		__m128i left = _mm_loadu_si128((const __m128i*)(_Left + i));
+		__m128i right = _mm_loadu_si128((const __m128i*)(_Right + i));
+		unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(left, right));
+		if (mask == 0xFFFF)
+			continue;
+		for (unsigned int j = 0; j < 16; ++j) {
+			if (!(mask & (1u << j)))
+				_EBoxPY_Ranges_Add(_Ranges, _Base + i + j, _Base + i + j + 1);
+		}
+	}
+	for (; i < _Size; ++i) {
+		if (_Left[i] != _Right[i])
+			_EBoxPY_Ranges_Add(_Ranges, _Base + i, _Base + i + 1);
+	}
+}
+
+// Single producer, single consumer ring of fixed Size records, Head_ and Tail_ only ever grow.
+typedef struct _EBoxPY_Ring_T {
+	unsigned char* Data_;
+	unsigned long long RecordSize_;
+	unsigned long long Capacity_;
+	char Padding0_[64];
+	volatile LONG64 Head_;
+	char Padding1_[64];
+	volatile LONG64 Tail_;
+	char Padding2_[64];
+	volatile LONG64 Dropped_;
+} _EBoxPY_Ring, *_PEBoxPY_Ring;
+
+static int _EBoxPY_Ring_Create(_PEBoxPY_Ring _Ring, unsigned long long _RecordSize, unsigned long long _Capacity) {
+	unsigned long long capacity = 1;
+	while (capacity < _Capacity)
+		capacity <<= 1;
+	memset(_Ring, 0, sizeof(_EBoxPY_Ring));
+	_Ring->Data_ = (unsigned char*)malloc(capacity * _RecordSize);
+	if (!_Ring->Data_)
+		return 0;
+	_Ring->RecordSize_ = _RecordSize;
+	_Ring->Capacity_ = capacity;
+	return 1;
+}
+
+static void _EBoxPY_Ring_Free(_PEBoxPY_Ring _Ring) {
+	free(_Ring->Data_);
+	_Ring->Data_ = NULL;
+}
+
+// Producer side, returns the next free record or NULL when the consumer has fallen a full ring behind.
+static unsigned char* _EBoxPY_Ring_Reserve(_PEBoxPY_Ring _Ring) {
+	unsigned long long head = (unsigned long long)_Ring->Head_;
+	if (head - (unsigned long long)_Ring->Tail_ >= _Ring->Capacity_) {
+		InterlockedIncrement64(&_Ring->Dropped_);
+		return NULL;
+	}
+	return _Ring->Data_ + (head & (_Ring->Capacity_ - 1)) * _Ring->RecordSize_;
+}
+
+static void _EBoxPY_Ring_Commit(_PEBoxPY_Ring _Ring) {
+	InterlockedExchange64(&_Ring->Head_, _Ring->Head_ + 1);
+}
+
+static unsigned long long _EBoxPY_Ring_Available(_PEBoxPY_Ring _Ring) {
+	return (unsigned long long)_Ring->Head_ - (unsigned long long)_Ring->Tail_;
+}
+
+// Consumer side, copies up to _Count records into _Output and releases them to the producer.
+static unsigned long long _EBoxPY_Ring_Drain(_PEBoxPY_Ring _Ring, unsigned char* _Output, unsigned long long _Count) {
+	unsigned long long tail = (unsigned long long)_Ring->Tail_;
+	unsigned long long available = (unsigned long long)_Ring->Head_ - tail;
+	if (_Count > available)
+		_Count = available;
+	unsigned long long index = tail & (_Ring->Capacity_ - 1);
+	unsigned long long first = _Ring->Capacity_ - index;
+	if (first > _Count)
+		first = _Count;
+	memcpy(_Output, _Ring->Data_ + index * _Ring->RecordSize_, first * _Ring->RecordSize_);
+	memcpy(_Output + first * _Ring->RecordSize_, _Ring->Data_, (_Count - first) * _Ring->RecordSize_);
+	InterlockedExchange64(&_Ring->Tail_, (LONG64)(tail + _Count));
+	return _Count;
+}
+
 /*
  *
  * EBoxPY.Region
@@ -90,31 +256,30 @@ static int _EBoxPY_Initialize_Region(PyObject* self) {
 	return 1;
 }
 
-static PyObject* _EBoxPY_Create_Region(HANDLE _Process, unsigned long long _Address) {
+static int _EBoxPY_Process_Query(PyObject* _Process, unsigned long long _Address, MEMORY_BASIC_INFORMATION* _Information, char* _Backed);
+
+static PyObject* _EBoxPY_Create_Region_Information(const MEMORY_BASIC_INFORMATION* _Information, char _Backed) {
 	PyObject* output = EBoxPY_Region_Type.tp_alloc(&EBoxPY_Region_Type, 1);
 	if (!output)
 		return NULL;
 	EBOXPY_OBJECT_ZERO(EBoxPY_Region, output);
 	PEBoxPY_Region region = (PEBoxPY_Region)output;
+	region->Allocation_ = (unsigned long long)_Information->AllocationBase;
+	region->Address_ = (unsigned long long)_Information->BaseAddress;
+	region->Size_ = (unsigned long long)_Information->RegionSize;
+	region->Protection_ = (unsigned long)_Information->Protect;
+	region->State_ = (unsigned long)_Information->State;
+	region->Type_ = (unsigned long)_Information->Type;
+	region->Backed_ = _Backed;
+	return output;
+}
+
+static PyObject* _EBoxPY_Create_Region(PyObject* _Process, unsigned long long _Address) {
 	MEMORY_BASIC_INFORMATION information = {0};
-	if (VirtualQueryEx(_Process, (void*)_Address, &information, sizeof(MEMORY_BASIC_INFORMATION)) == 0) {
-		Py_DECREF(output);
+	char backed = 0;
+	if (!_EBoxPY_Process_Query(_Process, _Address, &information, &backed))
 		return NULL;
-	}
-	region->Allocation_ = (unsigned long long)information.AllocationBase;
-	region->Address_ = (unsigned long long)information.BaseAddress;
-	region->Size_ = (unsigned long long)information.RegionSize;
-	region->Protection_ = (unsigned long)information.Protect;
-	region->State_ = (unsigned long)information.State;
-	region->Type_ = (unsigned long)information.Type;
-	PSAPI_WORKING_SET_EX_INFORMATION set = { 0 };
-	set.VirtualAddress = (void*)region->Address_;
-	if (!QueryWorkingSetEx(_Process, &set, sizeof(PSAPI_WORKING_SET_EX_INFORMATION))) {
-		Py_DECREF(output);
-		return NULL;
-	}
-	region->Backed_ = (char)(set.VirtualAttributes.Valid ? 1 : 0);
-	return output;
+	return _EBoxPY_Create_Region_Information(&information, backed);
 }
 
 static PyObject* EBoxPY_Region_repr(PyObject* self) {
@@ -217,6 +382,12 @@ typedef struct EBoxPY_Module_T {
 	//
 	unsigned int Architecture_;
 	//
+	PyObject* Process_;
+	//
+	unsigned long ExportAddress_;
+	unsigned long ExportSize_;
+	struct _EBoxPY_Exports_T* Exports_;
+	//
 } EBoxPY_Module, *PEBoxPY_Module;
 
 static void EBoxPY_Module_dealloc(PyObject* self);
@@ -224,6 +395,13 @@ static PyObject* EBoxPY_Module_repr(PyObject* self);
 
 static PyObject* EBoxPY_Module_IsAMD64(PEBoxPY_Module self);
 static PyObject* EBoxPY_Module_IsI386(PEBoxPY_Module self);
+static PyObject* EBoxPY_Module_GetExport(PEBoxPY_Module self, PyObject* name);
+static PyObject* EBoxPY_Module_GetExports(PEBoxPY_Module self);
+static PyObject* EBoxPY_Module_VerifyAgainstDisk(PEBoxPY_Module self);
+
+static int _EBoxPY_Process_Read(PyObject* _Process, unsigned long long _Address, void* _Buffer, unsigned long long _Size);
+static int _EBoxPY_Process_Pin(PyObject* _Process);
+static void _EBoxPY_Process_Unpin(PyObject* _Process);
 
 static PyMemberDef EBoxPY_Module_Members[] = {
 	{"Address_", T_ULONGLONG, offsetof(EBoxPY_Module, Address_), READONLY, PyDoc_STR("The base Address of the Module.")},
@@ -238,6 +416,9 @@ static PyMemberDef EBoxPY_Module_Members[] = {
 static PyMethodDef EBoxPY_Module_Methods[] = {
 	{"IsAMD64", (PyCFunction)EBoxPY_Module_IsAMD64, METH_NOARGS, PyDoc_STR("EBoxPY.Module.IsAMD64() -> bool\nTrue if the Module's Architecture is AMD64, False if otherwise.")},
 	{"IsI386", (PyCFunction)EBoxPY_Module_IsI386, METH_NOARGS, PyDoc_STR("EBoxPY.Module.IsI386() -> bool\nTrue if the Module's Architecture is I386, False if otherwise.")},
+	{"GetExport", (PyCFunction)EBoxPY_Module_GetExport, METH_O, PyDoc_STR("EBoxPY.Module.GetExport(_Name) -> int | str\nGets the Address of an Export by Name or Ordinal, or the \"Module.Function\" string of a forwarded Export.")},
+	{"GetExports", (PyCFunction)EBoxPY_Module_GetExports, METH_NOARGS, PyDoc_STR("EBoxPY.Module.GetExports() -> { \"Function\" : int | str, Ordinal : int | str, ... }\nRetrieves a dictionary of every Export in the Module, unnamed Exports are keyed by Ordinal.")},
+	{"VerifyAgainstDisk", (PyCFunction)EBoxPY_Module_VerifyAgainstDisk, METH_NOARGS, PyDoc_STR("EBoxPY.Module.VerifyAgainstDisk() -> [ (Address, Size), ... ]\nCompares the executable Sections against the relocated file at Path_, returns the differing Ranges.")},
 	{NULL}
 };
 
@@ -263,64 +444,299 @@ static int _EBoxPY_Initialize_Module(PyObject* self) {
 	return 1;
 }
 
-static PyObject* _EBoxPY_Create_Module(HANDLE _Process, MODULEENTRY32W _Entry) {
-	PyObject* output = EBoxPY_Module_Type.tp_alloc(&EBoxPY_Module_Type, 1);
+#define EBOXPY_EXPORT_NAME_SIZE 0x100
+
+typedef struct _EBoxPY_Export_T {
+	unsigned long Hash_;
+	unsigned long Length_;
+	unsigned long long Name_;
+	unsigned long Index_;
+} _EBoxPY_Export, *_PEBoxPY_Export;
+
+typedef struct _EBoxPY_Exports_T {
+	unsigned long Base_;
+	unsigned long FunctionCount_;
+	unsigned long* Functions_;
+	//
+	unsigned long NameCount_;
+	_PEBoxPY_Export Names_;
+	char* Strings_;
+	unsigned long long StringsSize_;
+	//
+	unsigned long Capacity_;
+	unsigned long* Table_;
+	//
+	unsigned char* Directory_;
+} _EBoxPY_Exports, *_PEBoxPY_Exports;
+
+static void _EBoxPY_Exports_Free(_PEBoxPY_Exports _Exports) {
+	if (!_Exports)
+		return;
+	free(_Exports->Functions_);
+	free(_Exports->Names_);
+	free(_Exports->Strings_);
+	free(_Exports->Table_);
+	free(_Exports->Directory_);
+	free(_Exports);
+}
+
+static unsigned long _EBoxPY_Exports_Hash(const char* _Name, unsigned long long _Length) {
+	unsigned long hash = 2166136261UL;
+	for (unsigned long long i = 0; i < _Length; ++i) {
+		hash ^= (unsigned char)_Name[i];
+		hash *= 16777619UL;
+	}
+	return hash;
+}
+
+// Copies an array out of the cached Export Directory, or Reads it when the linker placed it elsewhere.
+static void* _EBoxPY_Exports_Array(PEBoxPY_Module _Module, unsigned char* _Directory, unsigned long _Address, unsigned long long _Size) {
+	void* output = malloc(_Size ? _Size : 1);
 	if (!output)
 		return NULL;
-	EBOXPY_OBJECT_ZERO(EBoxPY_Module, output);
-	PEBoxPY_Module _module = (PEBoxPY_Module)output;
-	_module->Address_ = (unsigned long long)_Entry.modBaseAddr;
-	_module->Size_ = (unsigned long long)_Entry.modBaseSize;
-	_module->Name_ = PyUnicode_FromWideChar(_Entry.szModule, -1);
-	if (!_module->Name_) {
-		Py_DECREF(output);
-		return NULL;
+	if (_Address >= _Module->ExportAddress_ && (unsigned long long)_Address + _Size <= (unsigned long long)_Module->ExportAddress_ + _Module->ExportSize_) {
+		memcpy(output, _Directory + (_Address - _Module->ExportAddress_), _Size);
+		return output;
 	}
-	_module->Path_ = PyUnicode_FromWideChar(_Entry.szExePath, -1);
-	if (!_module->Name_) {
-		Py_DECREF(output);
+	if (!_EBoxPY_Process_Read(_Module->Process_, _Module->Address_ + _Address, output, _Size)) {
+		free(output);
 		return NULL;
 	}
-	unsigned char* headers = (unsigned char*)malloc(EBOXPY_PE_HEADERS_SIZE);
-	if (!headers) {
-		Py_DECREF(output);
+	return output;
+}
+
+static int _EBoxPY_Exports_Add_Name(_PEBoxPY_Exports _Exports, unsigned long long* _Capacity, const char* _Name, unsigned long long _Length, unsigned long _Index) {
+	if (_Exports->StringsSize_ + _Length + 1 > *_Capacity) {
+		unsigned long long capacity = (*_Capacity ? *_Capacity * 2 : 0x1000);
+		while (capacity < _Exports->StringsSize_ + _Length + 1)
+			capacity *= 2;
+		char* strings = (char*)realloc(_Exports->Strings_, capacity);
+		if (!strings)
+			return 0;
+		_Exports->Strings_ = strings;
+		*_Capacity = capacity;
+	}
+	_PEBoxPY_Export entry = &_Exports->Names_[_Exports->NameCount_++];
+	entry->Hash_ = _EBoxPY_Exports_Hash(_Name, _Length);
+	entry->Length_ = (unsigned long)_Length;
+	entry->Name_ = _Exports->StringsSize_;
+	entry->Index_ = _Index;
+	memcpy(_Exports->Strings_ + _Exports->StringsSize_, _Name, _Length);
+	_Exports->Strings_[_Exports->StringsSize_ + _Length] = 0;
+	_Exports->StringsSize_ += _Length + 1;
+	return 1;
+}
+
+static _PEBoxPY_Exports _EBoxPY_Exports_Create(PEBoxPY_Module _Module) {
+	_PEBoxPY_Exports exports = (_PEBoxPY_Exports)calloc(1, sizeof(_EBoxPY_Exports));
+	if (!exports)
+		return NULL;
+	if (!_Module->ExportAddress_ || _Module->ExportSize_ < sizeof(IMAGE_EXPORT_DIRECTORY))
+		return exports;
+	exports->Directory_ = (unsigned char*)malloc((unsigned long long)_Module->ExportSize_ + 1);
+	if (!exports->Directory_) {
+		_EBoxPY_Exports_Free(exports);
+		return NULL;
+	}
+	if (!_EBoxPY_Process_Read(_Module->Process_, _Module->Address_ + _Module->ExportAddress_, exports->Directory_, _Module->ExportSize_)) {
+		_EBoxPY_Exports_Free(exports);
+		return NULL;
+	}
+	exports->Directory_[_Module->ExportSize_] = 0;
+	PIMAGE_EXPORT_DIRECTORY directory = (PIMAGE_EXPORT_DIRECTORY)exports->Directory_;
+	exports->Base_ = (unsigned long)directory->Base;
+	exports->FunctionCount_ = (unsigned long)directory->NumberOfFunctions;
+	exports->Functions_ = (unsigned long*)_EBoxPY_Exports_Array(_Module, exports->Directory_, directory->AddressOfFunctions, (unsigned long long)exports->FunctionCount_ * sizeof(unsigned long));
+	unsigned long* names = (unsigned long*)_EBoxPY_Exports_Array(_Module, exports->Directory_, directory->AddressOfNames, (unsigned long long)directory->NumberOfNames * sizeof(unsigned long));
+	unsigned short* ordinals = (unsigned short*)_EBoxPY_Exports_Array(_Module, exports->Directory_, directory->AddressOfNameOrdinals, (unsigned long long)directory->NumberOfNames * sizeof(unsigned short));
+	exports->Names_ = (_PEBoxPY_Export)malloc(((unsigned long long)directory->NumberOfNames + 1) * sizeof(_EBoxPY_Export));
+	if (!exports->Functions_ || !names || !ordinals || !exports->Names_) {
+		free(names);
+		free(ordinals);
+		_EBoxPY_Exports_Free(exports);
+		return NULL;
+	}
+	unsigned long long capacity = 0;
+	char buffer[EBOXPY_EXPORT_NAME_SIZE + 1] = {0};
+	for (unsigned long i = 0; i < (unsigned long)directory->NumberOfNames; ++i) {
+		if (ordinals[i] >= exports->FunctionCount_)
+			continue;
+		const char* name = NULL;
+		unsigned long long length = 0;
+		if (names[i] >= _Module->ExportAddress_ && names[i] < _Module->ExportAddress_ + _Module->ExportSize_) {
+			name = (const char*)(exports->Directory_ + (names[i] - _Module->ExportAddress_));
+			length = strnlen(name, (unsigned long long)(_Module->ExportAddress_ + _Module->ExportSize_ - names[i]));
+		}
+		else {
+			if (!_EBoxPY_Process_Read(_Module->Process_, _Module->Address_ + names[i], buffer, EBOXPY_EXPORT_NAME_SIZE))
+				continue;
+			name = buffer;
+			length = strnlen(buffer, EBOXPY_EXPORT_NAME_SIZE);
+		}
+		if (!_EBoxPY_Exports_Add_Name(exports, &capacity, name, length, (unsigned long)ordinals[i])) {
+			free(names);
+			free(ordinals);
+			_EBoxPY_Exports_Free(exports);
+			return NULL;
+		}
+	}
+	free(names);
+	free(ordinals);
+	exports->Capacity_ = 16;
+	while (exports->Capacity_ < exports->NameCount_ * 2)
+		exports->Capacity_ *= 2;
+	exports->Table_ = (unsigned long*)calloc(exports->Capacity_, sizeof(unsigned long));
+	if (!exports->Table_) {
+		_EBoxPY_Exports_Free(exports);
 		return NULL;
 	}
-	if (ReadProcessMemory(_Process, (void*)_module->Address_, (void*)headers, EBOXPY_PE_HEADERS_SIZE, NULL) == FALSE) {
-		free(headers);
-		Py_DECREF(output);
+	for (unsigned long i = 0; i < exports->NameCount_; ++i) {
+		unsigned long slot = exports->Names_[i].Hash_ & (exports->Capacity_ - 1);
+		while (exports->Table_[slot])
+			slot = (slot + 1) & (exports->Capacity_ - 1);
+		exports->Table_[slot] = i + 1;
+	}
+	return exports;
+}
+
+static _PEBoxPY_Export _EBoxPY_Exports_Find(_PEBoxPY_Exports _Exports, const char* _Name, unsigned long long _Length) {
+	if (!_Exports->Table_)
 		return NULL;
+	unsigned long hash = _EBoxPY_Exports_Hash(_Name, _Length);
+	for (unsigned long slot = hash & (_Exports->Capacity_ - 1); _Exports->Table_[slot]; slot = (slot + 1) & (_Exports->Capacity_ - 1)) {
+		_PEBoxPY_Export entry = &_Exports->Names_[_Exports->Table_[slot] - 1];
+		if (entry->Hash_ == hash && entry->Length_ == _Length && memcmp(_Exports->Strings_ + entry->Name_, _Name, _Length) == 0)
+			return entry;
+	}
+	return NULL;
+}
+
+static int _EBoxPY_Module_Load_Exports(PEBoxPY_Module _Module) {
+	if (_Module->Exports_)
+		return 1;
+	_Module->Exports_ = _EBoxPY_Exports_Create(_Module);
+	return _Module->Exports_ != NULL;
+}
+
+// Forwarded Exports point back inside the Export Directory at a "Module.Function" string.
+static PyObject* _EBoxPY_Module_Export_Object(PEBoxPY_Module _Module, unsigned long _Index) {
+	unsigned long address = _Module->Exports_->Functions_[_Index];
+	if (address >= _Module->ExportAddress_ && address < _Module->ExportAddress_ + _Module->ExportSize_)
+		return PyUnicode_FromString((const char*)(_Module->Exports_->Directory_ + (address - _Module->ExportAddress_)));
+	return PyLong_FromUnsignedLongLong(_Module->Address_ + address);
+}
+
+// A Module as collected without the GIL, the headers and every Section's Region are already Read and Queried.
+typedef struct _EBoxPY_Module_Record_T {
+	unsigned long long Address_;
+	unsigned long long Size_;
+	wchar_t Name_[MAX_MODULE_NAME32 + 1];
+	wchar_t Path_[MAX_PATH];
+	unsigned int Architecture_;
+	unsigned char* Headers_;
+	MEMORY_BASIC_INFORMATION* Sections_;
+	char* Backed_;
+} _EBoxPY_Module_Record, *_PEBoxPY_Module_Record;
+
+static void _EBoxPY_Module_Record_Free(_PEBoxPY_Module_Record _Record) {
+	free(_Record->Headers_);
+	free(_Record->Sections_);
+	free(_Record->Backed_);
+	_Record->Headers_ = NULL;
+	_Record->Sections_ = NULL;
+	_Record->Backed_ = NULL;
+}
+
+static PIMAGE_SECTION_HEADER _EBoxPY_Module_Record_Sections(_PEBoxPY_Module_Record _Record, unsigned short* _Count) {
+	PIMAGE_DOS_HEADER dos = (PIMAGE_DOS_HEADER)_Record->Headers_;
+	PIMAGE_FILE_HEADER file = (PIMAGE_FILE_HEADER)(_Record->Headers_ + dos->e_lfanew + 0x4);
+	*_Count = file->NumberOfSections;
+	return (PIMAGE_SECTION_HEADER)(_Record->Headers_ + dos->e_lfanew + (_Record->Architecture_ == EBOXPY_ARCHITECTURE_AMD64 ? sizeof(IMAGE_NT_HEADERS64) : sizeof(IMAGE_NT_HEADERS32)));
+}
+
+// Does not touch Python, returns 0 for anything that is not a mapped PE image.
+static int _EBoxPY_Module_Record_Load(PyObject* _Process, _PEBoxPY_Module_Record _Record) {
+	_Record->Headers_ = (unsigned char*)malloc(EBOXPY_PE_HEADERS_SIZE);
+	if (!_Record->Headers_)
+		return 0;
+	if (!_EBoxPY_Process_Read(_Process, _Record->Address_, (void*)_Record->Headers_, EBOXPY_PE_HEADERS_SIZE)) {
+		_EBoxPY_Module_Record_Free(_Record);
+		return 0;
 	}
-	PIMAGE_DOS_HEADER dos = (PIMAGE_DOS_HEADER)headers;
+	PIMAGE_DOS_HEADER dos = (PIMAGE_DOS_HEADER)_Record->Headers_;
 	if (dos->e_magic != IMAGE_DOS_SIGNATURE) {
-		free(headers);
-		Py_DECREF(output);
-		return NULL;
+		_EBoxPY_Module_Record_Free(_Record);
+		return 0;
 	}
-	PIMAGE_FILE_HEADER file = (PIMAGE_FILE_HEADER)(headers + dos->e_lfanew + 0x4);
+	PIMAGE_FILE_HEADER file = (PIMAGE_FILE_HEADER)(_Record->Headers_ + dos->e_lfanew + 0x4);
 	switch (file->Machine) {
 		case IMAGE_FILE_MACHINE_I386:
-			_module->Architecture_ = EBOXPY_ARCHITECTURE_I386;
+			_Record->Architecture_ = EBOXPY_ARCHITECTURE_I386;
 			break;
 		case IMAGE_FILE_MACHINE_IA64:
 		case IMAGE_FILE_MACHINE_AMD64:
-			_module->Architecture_ = EBOXPY_ARCHITECTURE_AMD64;
+			_Record->Architecture_ = EBOXPY_ARCHITECTURE_AMD64;
 			break;
 		default:
-			free(headers);
-			Py_DECREF(output);
-			return NULL;
+			_EBoxPY_Module_Record_Free(_Record);
+			return 0;
+	}
+	unsigned short count = 0;
+	PIMAGE_SECTION_HEADER section = _EBoxPY_Module_Record_Sections(_Record, &count);
+	_Record->Sections_ = (MEMORY_BASIC_INFORMATION*)calloc((size_t)count + 1, sizeof(MEMORY_BASIC_INFORMATION));
+	_Record->Backed_ = (char*)calloc((size_t)count + 1, sizeof(char));
+	if (!_Record->Sections_ || !_Record->Backed_) {
+		_EBoxPY_Module_Record_Free(_Record);
+		return 0;
+	}
+	// A Section that cannot be Queried keeps a zero RegionSize and is left out of Sections_.
+	for (unsigned short i = 0; i < count; ++i) {
+		if (!_EBoxPY_Process_Query(_Process, (unsigned long long)section[i].VirtualAddress + _Record->Address_, &_Record->Sections_[i], &_Record->Backed_[i]))
+			memset(&_Record->Sections_[i], 0, sizeof(MEMORY_BASIC_INFORMATION));
+	}
+	return 1;
+}
+
+static PyObject* _EBoxPY_Create_Module_Record(PyObject* _Process, _PEBoxPY_Module_Record _Record) {
+	PyObject* output = EBoxPY_Module_Type.tp_alloc(&EBoxPY_Module_Type, 1);
+	if (!output)
+		return NULL;
+	EBOXPY_OBJECT_ZERO(EBoxPY_Module, output);
+	PEBoxPY_Module _module = (PEBoxPY_Module)output;
+	Py_INCREF(_Process);
+	_module->Process_ = _Process;
+	_module->Address_ = _Record->Address_;
+	_module->Size_ = _Record->Size_;
+	_module->Architecture_ = _Record->Architecture_;
+	_module->Name_ = PyUnicode_FromWideChar(_Record->Name_, -1);
+	if (!_module->Name_) {
+		Py_DECREF(output);
+		return NULL;
+	}
+	_module->Path_ = PyUnicode_FromWideChar(_Record->Path_, -1);
+	if (!_module->Path_) {
+		Py_DECREF(output);
+		return NULL;
 	}
-	PIMAGE_SECTION_HEADER section = (PIMAGE_SECTION_HEADER)(headers + dos->e_lfanew + (_module->Architecture_ == EBOXPY_ARCHITECTURE_AMD64 ? sizeof(IMAGE_NT_HEADERS64) : sizeof(IMAGE_NT_HEADERS32)));
+	PIMAGE_DOS_HEADER dos = (PIMAGE_DOS_HEADER)_Record->Headers_;
+	PIMAGE_DATA_DIRECTORY directory = (_module->Architecture_ == EBOXPY_ARCHITECTURE_AMD64 ? ((PIMAGE_NT_HEADERS64)(_Record->Headers_ + dos->e_lfanew))->OptionalHeader.DataDirectory : ((PIMAGE_NT_HEADERS32)(_Record->Headers_ + dos->e_lfanew))->OptionalHeader.DataDirectory);
+	_module->ExportAddress_ = (unsigned long)directory[IMAGE_DIRECTORY_ENTRY_EXPORT].VirtualAddress;
+	_module->ExportSize_ = (unsigned long)directory[IMAGE_DIRECTORY_ENTRY_EXPORT].Size;
+	unsigned short count = 0;
+	PIMAGE_SECTION_HEADER section = _EBoxPY_Module_Record_Sections(_Record, &count);
 	_module->Sections_ = PyDict_New();
-	for (unsigned short i = 0; i < file->NumberOfSections; ++i) {
-		unsigned long long address = (unsigned long long)section[i].VirtualAddress + _module->Address_;
-		unsigned long long size = (unsigned long long)section[i].Misc.VirtualSize;
-		PEBoxPY_Region region = (PEBoxPY_Region)_EBoxPY_Create_Region(_Process, address);
+	if (!_module->Sections_) {
+		Py_DECREF(output);
+		return NULL;
+	}
+	for (unsigned short i = 0; i < count; ++i) {
+		if (!_Record->Sections_[i].RegionSize)
+			continue;
+		PEBoxPY_Region region = (PEBoxPY_Region)_EBoxPY_Create_Region_Information(&_Record->Sections_[i], _Record->Backed_[i]);
 		if (!region)
 			continue;
-		region->Address_ = address;
-		region->Size_ = size;
+		region->Address_ = (unsigned long long)section[i].VirtualAddress + _module->Address_;
+		region->Size_ = (unsigned long long)section[i].Misc.VirtualSize;
 		char name[8 + 1] = {0};
 		memcpy((void*)name, (void*)section[i].Name, 8);
 		PyObject* key = PyUnicode_FromString(name);
@@ -332,7 +748,6 @@ static PyObject* _EBoxPY_Create_Module(HANDLE _Process, MODULEENTRY32W _Entry) {
 		Py_DECREF(key);
 		Py_DECREF((PyObject*)region);
 	}
-	free(headers);
 	return output;
 }
 
@@ -341,6 +756,8 @@ static void EBoxPY_Module_dealloc(PyObject* self) {
 	Py_XDECREF(_module->Name_);
 	Py_XDECREF(_module->Path_);
 	Py_XDECREF(_module->Sections_);
+	Py_XDECREF(_module->Process_);
+	_EBoxPY_Exports_Free(_module->Exports_);
 	Py_TYPE(self)->tp_free(self);
 }
 
@@ -378,6 +795,352 @@ static PyObject* EBoxPY_Module_IsI386(PEBoxPY_Module self) {
 	}
 }
 
+static PyObject* EBoxPY_Module_GetExport(PEBoxPY_Module self, PyObject* name) {
+	if (!_EBoxPY_Module_Load_Exports(self)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Module.GetExport failed to Read Exports.");
+		return NULL;
+	}
+	unsigned long index = 0;
+	if (PyUnicode_Check(name)) {
+		Py_ssize_t length = 0;
+		const char* _name = PyUnicode_AsUTF8AndSize(name, &length);
+		if (!_name)
+			return NULL;
+		_PEBoxPY_Export entry = _EBoxPY_Exports_Find(self->Exports_, _name, (unsigned long long)length);
+		if (!entry) {
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Module.GetExport failed to Locate Export.");
+			return NULL;
+		}
+		index = entry->Index_;
+	}
+	else if (PyLong_Check(name)) {
+		unsigned long long ordinal = PyLong_AsUnsignedLongLong(name);
+		if (PyErr_Occurred())
+			return NULL;
+		if (ordinal < self->Exports_->Base_ || ordinal - self->Exports_->Base_ >= self->Exports_->FunctionCount_) {
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Module.GetExport failed to Locate Export.");
+			return NULL;
+		}
+		index = (unsigned long)(ordinal - self->Exports_->Base_);
+	}
+	else {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Module.GetExport requires _Name to be str or int.");
+		return NULL;
+	}
+	if (!self->Exports_->Functions_[index]) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Module.GetExport failed to Locate Export.");
+		return NULL;
+	}
+	return _EBoxPY_Module_Export_Object(self, index);
+}
+
+static PyObject* EBoxPY_Module_GetExports(PEBoxPY_Module self) {
+	if (!_EBoxPY_Module_Load_Exports(self)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Module.GetExports failed to Read Exports.");
+		return NULL;
+	}
+	_PEBoxPY_Exports exports = self->Exports_;
+	PyObject* dictionary = PyDict_New();
+	if (!dictionary)
+		return NULL;
+	char* named = (char*)calloc(exports->FunctionCount_ + 1, 1);
+	if (!named) {
+		Py_DECREF(dictionary);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Module.GetExports failed to allocate memory.");
+		return NULL;
+	}
+	for (unsigned long i = 0; i < exports->NameCount_; ++i) {
+		_PEBoxPY_Export entry = &exports->Names_[i];
+		named[entry->Index_] = 1;
+		if (!exports->Functions_[entry->Index_])
+			continue;
+		PyObject* key = PyUnicode_FromStringAndSize(exports->Strings_ + entry->Name_, (Py_ssize_t)entry->Length_);
+		PyObject* value = _EBoxPY_Module_Export_Object(self, entry->Index_);
+		if (!key || !value || PyDict_SetItem(dictionary, key, value) != 0) {
+			Py_XDECREF(key);
+			Py_XDECREF(value);
+			Py_DECREF(dictionary);
+			free(named);
+			return NULL;
+		}
+		Py_DECREF(key);
+		Py_DECREF(value);
+	}
+	for (unsigned long i = 0; i < exports->FunctionCount_; ++i) {
+		if (named[i] || !exports->Functions_[i])
+			continue;
+		PyObject* key = PyLong_FromUnsignedLong(exports->Base_ + i);
+		PyObject* value = _EBoxPY_Module_Export_Object(self, i);
+		if (!key || !value || PyDict_SetItem(dictionary, key, value) != 0) {
+			Py_XDECREF(key);
+			Py_XDECREF(value);
+			Py_DECREF(dictionary);
+			free(named);
+			return NULL;
+		}
+		Py_DECREF(key);
+		Py_DECREF(value);
+	}
+	free(named);
+	return dictionary;
+}
+
+#define EBOXPY_VERIFY_BLOCK 0x10000
+#define EBOXPY_PAGE_SIZE 0x1000
+
+typedef struct _EBoxPY_Image_T {
+	HANDLE File_;
+	HANDLE Mapping_;
+	unsigned char* View_;
+	unsigned long long Size_;
+	//
+	PIMAGE_SECTION_HEADER Sections_;
+	unsigned short SectionCount_;
+	//
+	unsigned long long ImageBase_;
+	IMAGE_DATA_DIRECTORY Relocations_;
+} _EBoxPY_Image, *_PEBoxPY_Image;
+
+static void _EBoxPY_Image_Close(_PEBoxPY_Image _Image) {
+	if (_Image->View_)
+		UnmapViewOfFile(_Image->View_);
+	if (_Image->Mapping_)
+		CloseHandle(_Image->Mapping_);
+	if (_Image->File_ && _Image->File_ != INVALID_HANDLE_VALUE)
+		CloseHandle(_Image->File_);
+	memset(_Image, 0, sizeof(_EBoxPY_Image));
+}
+
+// Maps the PE file at _Path read-only in its on-disk layout.
+static int _EBoxPY_Image_Open(const wchar_t* _Path, _PEBoxPY_Image _Image) {
+	memset(_Image, 0, sizeof(_EBoxPY_Image));
+	_Image->File_ = CreateFileW(_Path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (_Image->File_ == INVALID_HANDLE_VALUE) {
+		_Image->File_ = NULL;
+		return 0;
+	}
+	LARGE_INTEGER size = {0};
+	if (!GetFileSizeEx(_Image->File_, &size) || size.QuadPart < (LONGLONG)sizeof(IMAGE_DOS_HEADER)) {
+		_EBoxPY_Image_Close(_Image);
+		return 0;
+	}
+	_Image->Size_ = (unsigned long long)size.QuadPart;
+	_Image->Mapping_ = CreateFileMappingW(_Image->File_, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (!_Image->Mapping_) {
+		_EBoxPY_Image_Close(_Image);
+		return 0;
+	}
+	_Image->View_ = (unsigned char*)MapViewOfFile(_Image->Mapping_, FILE_MAP_READ, 0, 0, 0);
+	if (!_Image->View_) {
+		_EBoxPY_Image_Close(_Image);
+		return 0;
+	}
+	PIMAGE_DOS_HEADER dos = (PIMAGE_DOS_HEADER)_Image->View_;
+	if (dos->e_magic != IMAGE_DOS_SIGNATURE || dos->e_lfanew < 0 || (unsigned long long)dos->e_lfanew + sizeof(IMAGE_NT_HEADERS64) > _Image->Size_) {
+		_EBoxPY_Image_Close(_Image);
+		return 0;
+	}
+	PIMAGE_FILE_HEADER file = (PIMAGE_FILE_HEADER)(_Image->View_ + dos->e_lfanew + 0x4);
+	unsigned short magic = *(unsigned short*)(file + 1);
+	if (magic == IMAGE_NT_OPTIONAL_HDR64_MAGIC) {
+		PIMAGE_NT_HEADERS64 headers = (PIMAGE_NT_HEADERS64)(_Image->View_ + dos->e_lfanew);
+		_Image->ImageBase_ = (unsigned long long)headers->OptionalHeader.ImageBase;
+		_Image->Relocations_ = headers->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_BASERELOC];
+	}
+	else if (magic == IMAGE_NT_OPTIONAL_HDR32_MAGIC) {
+		PIMAGE_NT_HEADERS32 headers = (PIMAGE_NT_HEADERS32)(_Image->View_ + dos->e_lfanew);
+		_Image->ImageBase_ = (unsigned long long)headers->OptionalHeader.ImageBase;
+		_Image->Relocations_ = headers->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_BASERELOC];
+	}
+	else {
+		_EBoxPY_Image_Close(_Image);
+		return 0;
+	}
+	unsigned long long sections = (unsigned long long)dos->e_lfanew + 0x4 + sizeof(IMAGE_FILE_HEADER) + file->SizeOfOptionalHeader;
+	if (sections + (unsigned long long)file->NumberOfSections * sizeof(IMAGE_SECTION_HEADER) > _Image->Size_) {
+		_EBoxPY_Image_Close(_Image);
+		return 0;
+	}
+	_Image->Sections_ = (PIMAGE_SECTION_HEADER)(_Image->View_ + sections);
+	_Image->SectionCount_ = file->NumberOfSections;
+	return 1;
+}
+
+static PIMAGE_SECTION_HEADER _EBoxPY_Image_Section(_PEBoxPY_Image _Image, unsigned long _Address) {
+	for (unsigned short i = 0; i < _Image->SectionCount_; ++i) {
+		PIMAGE_SECTION_HEADER section = &_Image->Sections_[i];
+		unsigned long size = (section->Misc.VirtualSize ? section->Misc.VirtualSize : section->SizeOfRawData);
+		if (_Address >= section->VirtualAddress && _Address < section->VirtualAddress + size)
+			return section;
+	}
+	return NULL;
+}
+
+// Translates an RVA range to a pointer into the mapped file, NULL if it is not backed by raw data.
+static unsigned char* _EBoxPY_Image_Pointer(_PEBoxPY_Image _Image, unsigned long _Address, unsigned long long _Size) {
+	PIMAGE_SECTION_HEADER section = _EBoxPY_Image_Section(_Image, _Address);
+	if (!section)
+		return NULL;
+	unsigned long long offset = (unsigned long long)(_Address - section->VirtualAddress);
+	if (offset + _Size > section->SizeOfRawData || (unsigned long long)section->PointerToRawData + offset + _Size > _Image->Size_)
+		return NULL;
+	return _Image->View_ + section->PointerToRawData + offset;
+}
+
+// Lays a Section out as the loader would, then applies the base relocations that land inside it.
+static int _EBoxPY_Image_Load_Section(_PEBoxPY_Image _Image, PIMAGE_SECTION_HEADER _Section, unsigned char* _Buffer, unsigned long long _Size, unsigned long long _Delta) {
+	memset(_Buffer, 0, _Size);
+	unsigned long long raw = (_Section->SizeOfRawData < _Size ? _Section->SizeOfRawData : _Size);
+	if ((unsigned long long)_Section->PointerToRawData + raw > _Image->Size_)
+		return 0;
+	memcpy(_Buffer, _Image->View_ + _Section->PointerToRawData, raw);
+	if (!_Delta || !_Image->Relocations_.VirtualAddress)
+		return 1;
+	unsigned char* relocations = _EBoxPY_Image_Pointer(_Image, _Image->Relocations_.VirtualAddress, _Image->Relocations_.Size);
+	if (!relocations)
+		return 1;
+	unsigned long long start = _Section->VirtualAddress;
+	unsigned long long end = start + _Size;
+	for (unsigned long long offset = 0; offset + sizeof(IMAGE_BASE_RELOCATION) <= _Image->Relocations_.Size;) {
+		PIMAGE_BASE_RELOCATION block = (PIMAGE_BASE_RELOCATION)(relocations + offset);
+		if (block->SizeOfBlock < sizeof(IMAGE_BASE_RELOCATION) || offset + block->SizeOfBlock > _Image->Relocations_.Size)
+			break;
+		if ((unsigned long long)block->VirtualAddress + EBOXPY_PAGE_SIZE > start && (unsigned long long)block->VirtualAddress < end) {
+			unsigned short* entries = (unsigned short*)(block + 1);
+			unsigned long count = (unsigned long)((block->SizeOfBlock - sizeof(IMAGE_BASE_RELOCATION)) / sizeof(unsigned short));
+			for (unsigned long i = 0; i < count; ++i) {
+				unsigned long long address = (unsigned long long)block->VirtualAddress + (entries[i] & 0xFFF);
+				switch (entries[i] >> 12) {
+					case IMAGE_REL_BASED_DIR64:
+						if (address >= start && address + 8 <= end)
+							*(unsigned long long*)(_Buffer + (address - start)) += _Delta;
+						break;
+					case IMAGE_REL_BASED_HIGHLOW:
+						if (address >= start && address + 4 <= end)
+							*(unsigned int*)(_Buffer + (address - start)) += (unsigned int)_Delta;
+						break;
+					default:
+						break;
+				}
+			}
+		}
+		offset += block->SizeOfBlock;
+	}
+	return 1;
+}
+
+typedef struct _EBoxPY_Verify_T {
+	const unsigned char* Disk_;
+	const unsigned char* Memory_;
+	unsigned long long Size_;
+	unsigned long long Base_;
+	_EBoxPY_Ranges Ranges_;
+} _EBoxPY_Verify, *_PEBoxPY_Verify;
+
+static DWORD WINAPI _EBoxPY_Verify_Routine(LPVOID _Context) {
+	_PEBoxPY_Verify verify = (_PEBoxPY_Verify)_Context;
+	_EBoxPY_Compare(verify->Disk_, verify->Memory_, verify->Size_, verify->Base_, &verify->Ranges_);
+	return 0;
+}
+
+static int _EBoxPY_Module_Verify_Section(PEBoxPY_Module _Module, _PEBoxPY_Image _Image, PIMAGE_SECTION_HEADER _Section, unsigned long long _Size, _PEBoxPY_Ranges _Output) {
+	unsigned long long address = _Module->Address_ + _Section->VirtualAddress;
+	unsigned char* disk = (unsigned char*)malloc(_Size);
+	unsigned char* memory = (unsigned char*)malloc(_Size);
+	if (!disk || !memory || !_EBoxPY_Image_Load_Section(_Image, _Section, disk, _Size, _Module->Address_ - _Image->ImageBase_)) {
+		free(disk);
+		free(memory);
+		return 0;
+	}
+	if (!_EBoxPY_Process_Read(_Module->Process_, address, memory, _Size)) {
+		for (unsigned long long i = 0; i < _Size; i += EBOXPY_PAGE_SIZE) {
+			unsigned long long size = (_Size - i < EBOXPY_PAGE_SIZE ? _Size - i : EBOXPY_PAGE_SIZE);
+			if (_EBoxPY_Process_Read(_Module->Process_, address + i, memory + i, size))
+				continue;
+			// Unreadable pages are reported as differing in full.
+			for (unsigned long long j = i; j < i + size; ++j)
+				memory[j] = (unsigned char)~disk[j];
+		}
+	}
+	_EBoxPY_Verify contexts[EBOXPY_PARALLEL_MAXIMUM];
+	memset(contexts, 0, sizeof(contexts));
+	unsigned long count = _EBoxPY_Parallel_Count();
+	if (count > _Size / EBOXPY_VERIFY_BLOCK + 1)
+		count = (unsigned long)(_Size / EBOXPY_VERIFY_BLOCK + 1);
+	unsigned long long chunk = ((_Size / count) + 15) & ~15ULL;
+	for (unsigned long i = 0; i < count; ++i) {
+		unsigned long long start = (i * chunk < _Size ? i * chunk : _Size);
+		unsigned long long end = (i + 1 == count || (i + 1) * chunk > _Size ? _Size : (i + 1) * chunk);
+		contexts[i].Disk_ = disk + start;
+		contexts[i].Memory_ = memory + start;
+		contexts[i].Size_ = end - start;
+		contexts[i].Base_ = address + start;
+	}
+	_EBoxPY_Parallel(count, _EBoxPY_Verify_Routine, contexts, sizeof(_EBoxPY_Verify));
+	int status = 1;
+	for (unsigned long i = 0; i < count; ++i) {
+		if (contexts[i].Ranges_.Failed_)
+			status = 0;
+		for (unsigned long long j = 0; j < contexts[i].Ranges_.Count_; ++j)
+			_EBoxPY_Ranges_Add(_Output, contexts[i].Ranges_.Data_[2 * j], contexts[i].Ranges_.Data_[2 * j + 1]);
+		_EBoxPY_Ranges_Free(&contexts[i].Ranges_);
+	}
+	free(disk);
+	free(memory);
+	return status && !_Output->Failed_;
+}
+
+static PyObject* EBoxPY_Module_VerifyAgainstDisk(PEBoxPY_Module self) {
+	wchar_t* path = PyUnicode_AsWideCharString(self->Path_, NULL);
+	if (!path)
+		return NULL;
+	_EBoxPY_Image image;
+	int status = 0;
+	Py_BEGIN_ALLOW_THREADS
+	status = _EBoxPY_Image_Open(path, &image);
+	Py_END_ALLOW_THREADS
+	PyMem_Free(path);
+	if (!status) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Module.VerifyAgainstDisk failed to Map the Module from disk.");
+		return NULL;
+	}
+	PyObject* sections = PyDict_Values(self->Sections_);
+	if (!sections) {
+		_EBoxPY_Image_Close(&image);
+		return NULL;
+	}
+	if (!_EBoxPY_Process_Pin(self->Process_)) {
+		Py_DECREF(sections);
+		_EBoxPY_Image_Close(&image);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	_EBoxPY_Ranges ranges = {0};
+	for (Py_ssize_t i = 0; i < PyList_GET_SIZE(sections) && status; ++i) {
+		PEBoxPY_Region region = (PEBoxPY_Region)PyList_GET_ITEM(sections, i);
+		if (!(region->Protection_ & EBOXPY_REGION_EXECUTABLE) || !region->Size_ || region->Address_ < self->Address_)
+			continue;
+		PIMAGE_SECTION_HEADER section = _EBoxPY_Image_Section(&image, (unsigned long)(region->Address_ - self->Address_));
+		if (!section || section->VirtualAddress != region->Address_ - self->Address_)
+			continue;
+		unsigned long long size = region->Size_;
+		Py_BEGIN_ALLOW_THREADS
+		status = _EBoxPY_Module_Verify_Section(self, &image, section, size, &ranges);
+		Py_END_ALLOW_THREADS
+	}
+	_EBoxPY_Process_Unpin(self->Process_);
+	Py_DECREF(sections);
+	_EBoxPY_Image_Close(&image);
+	if (!status) {
+		_EBoxPY_Ranges_Free(&ranges);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Module.VerifyAgainstDisk failed to Compare Sections.");
+		return NULL;
+	}
+	PyObject* output = _EBoxPY_Ranges_List(&ranges);
+	_EBoxPY_Ranges_Free(&ranges);
+	return output;
+}
+
 /*
  *
  * EBoxPY.Bytes
@@ -511,6 +1274,10 @@ typedef struct EBoxPY_Bytes_T {
 	unsigned char* Allocation_;
 	unsigned long long Size_;
 	//
+	char IsView_;
+	char IsWritable_;
+	PyObject* Owner_;
+	//
 } EBoxPY_Bytes, *PEBoxPY_Bytes;
 
 static int EBoxPY_Bytes_init(PyObject* self, PyObject* args, PyObject* kwds);
@@ -526,6 +1293,8 @@ static PyObject* EBoxPY_Bytes_CopyFrom(PEBoxPY_Bytes self, PyObject* args);
 static PyMemberDef EBoxPY_Bytes_Members[] = {
 	{"Allocation_", T_ULONGLONG, offsetof(EBoxPY_Bytes, Allocation_), READONLY, PyDoc_STR("The Allocation of Bytes.")},
 	{"Size_", T_ULONGLONG, offsetof(EBoxPY_Bytes, Size_), READONLY, PyDoc_STR("The Size of the Allocation.")},
+	{"IsView_", T_BOOL, offsetof(EBoxPY_Bytes, IsView_), READONLY, PyDoc_STR("True if the Bytes is a View over live memory of the current Process, see EBoxPY.Process.View, the Allocation is then not owned.")},
+	{"IsWritable_", T_BOOL, offsetof(EBoxPY_Bytes, IsWritable_), READONLY, PyDoc_STR("False for a View over memory that was not writable when the View was created, Set and CopyFrom then raise.")},
 	{NULL}
 };
 
@@ -583,7 +1352,21 @@ static PyObject* _EBoxPY_Create_Bytes(unsigned long long _Size) {
 	return output;
 }
 
-static int EBoxPY_Bytes_init(PyObject* self, PyObject* args, PyObject* kwds) {
+static int _EBoxPY_Self_Copy(void* _Destination, const void* _Source, unsigned long long _Size);
+
+// A View's memory can be freed or reprotected at any time, every access to it goes through the faulting copy.
+static int _EBoxPY_Bytes_Transfer(void* _Destination, const void* _Source, unsigned long long _Size, int _View) {
+	if (_View)
+		return _EBoxPY_Self_Copy(_Destination, _Source, _Size);
+	memcpy(_Destination, _Source, (size_t)_Size);
+	return 1;
+}
+
+static int EBoxPY_Bytes_init(PyObject* self, PyObject* args, PyObject* kwds) {
+	if (((PEBoxPY_Bytes)self)->IsView_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Bytes.__init__ can not re-initialize a View.");
+		return -1;
+	}
 	EBOXPY_OBJECT_ZERO(EBoxPY_Bytes, self);
 	if (PyTuple_Size(args) != 1) {
 		PyErr_SetString(PyExc_TypeError, "EBoxPY.Bytes.__init__ requires 1 argument.");
@@ -598,7 +1381,13 @@ static int EBoxPY_Bytes_init(PyObject* self, PyObject* args, PyObject* kwds) {
 			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Bytes.__init__ failed to allocate memory.");
 			return -1;
 		}
-		memcpy((void*)bytes->Allocation_, (void*)other->Allocation_, bytes->Size_);
+		if (!_EBoxPY_Bytes_Transfer((void*)bytes->Allocation_, (void*)other->Allocation_, bytes->Size_, other->IsView_)) {
+			free(bytes->Allocation_);
+			bytes->Allocation_ = NULL;
+			bytes->Size_ = 0;
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Bytes.__init__ faulted on the View's memory.");
+			return -1;
+		}
 		return 0;
 	}
 	else if (PyLong_Check(PyTuple_GetItem(args, 0))) {
@@ -627,8 +1416,9 @@ static PyObject* EBoxPY_Bytes_new(PyTypeObject* type, PyObject* args, PyObject*
 
 static void EBoxPY_Bytes_dealloc(PyObject* self) {
 	PEBoxPY_Bytes bytes = (PEBoxPY_Bytes)self;
-	if (bytes->Allocation_)
+	if (bytes->Allocation_ && !bytes->IsView_)
 		free((void*)bytes->Allocation_);
+	Py_XDECREF(bytes->Owner_);
 	Py_TYPE(self)->tp_free(self);
 }
 
@@ -671,7 +1461,12 @@ static PyObject* EBoxPY_Bytes_Get(PEBoxPY_Bytes self, PyObject* args) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Bytes.Get address out of bounds.");
 		return NULL;
 	}
-	PyObject* output = _EBoxPY_NativeToPython((void*)(self->Allocation_ + offset), type);
+	unsigned long long native = 0;
+	if (!_EBoxPY_Bytes_Transfer(&native, self->Allocation_ + offset, size, self->IsView_)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Bytes.Get faulted on the View's memory.");
+		return NULL;
+	}
+	PyObject* output = _EBoxPY_NativeToPython((void*)&native, type);
 	if (!output) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Bytes.Get failed to convert Native type to Python object.");
 		return NULL;
@@ -711,14 +1506,21 @@ static PyObject* EBoxPY_Bytes_Set(PEBoxPY_Bytes self, PyObject* args) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Bytes.Set address out of bounds.");
 		return NULL;
 	}
-	if (_EBoxPY_PythonToNative(PyTuple_GetItem(args, 2), self->Allocation_ + offset, type)) {
-		Py_INCREF(Py_None);
-		return Py_None;
+	if (self->IsView_ && !self->IsWritable_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Bytes.IsWritable_ was False.");
+		return NULL;
 	}
-	else {
+	unsigned long long native = 0;
+	if (!_EBoxPY_PythonToNative(PyTuple_GetItem(args, 2), &native, type)) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Bytes.Set failed to convert Python object to Native type.");
 		return NULL;
 	}
+	if (!_EBoxPY_Bytes_Transfer(self->Allocation_ + offset, &native, size, self->IsView_)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Bytes.Set faulted on the View's memory.");
+		return NULL;
+	}
+	Py_INCREF(Py_None);
+	return Py_None;
 }
 
 static int _EBoxPY_Bytes_Copy(PEBoxPY_Bytes _Source, PEBoxPY_Bytes _Destination, unsigned long long _SourceIndex, unsigned long long _DestinationIndex, unsigned long long _Size) {
@@ -726,8 +1528,41 @@ static int _EBoxPY_Bytes_Copy(PEBoxPY_Bytes _Source, PEBoxPY_Bytes _Destination,
 		return 0;
 	if (_DestinationIndex + _Size > _Destination->Size_)
 		return 0;
-	memcpy(_Destination->Allocation_ + _DestinationIndex, _Source->Allocation_ + _SourceIndex, _Size);
-	return 1;
+	if (_Destination->IsView_ && !_Destination->IsWritable_)
+		return 0;
+	return _EBoxPY_Bytes_Transfer(_Destination->Allocation_ + _DestinationIndex, _Source->Allocation_ + _SourceIndex, _Size, _Source->IsView_ || _Destination->IsView_);
+}
+
+// Copies an EBoxPY.Bytes or any bytes-like object into a new allocation, so it can be used with the GIL released.
+static unsigned char* _EBoxPY_Bytes_Duplicate(PyObject* _Object, unsigned long long* _Size) {
+	if (PyObject_TypeCheck(_Object, &EBoxPY_Bytes_Type)) {
+		PEBoxPY_Bytes bytes = (PEBoxPY_Bytes)_Object;
+		unsigned char* output = (unsigned char*)malloc((size_t)bytes->Size_ + 1);
+		if (!output) {
+			PyErr_NoMemory();
+			return NULL;
+		}
+		if (!_EBoxPY_Bytes_Transfer(output, bytes->Allocation_, bytes->Size_, bytes->IsView_)) {
+			free(output);
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Bytes faulted on the View's memory.");
+			return NULL;
+		}
+		*_Size = bytes->Size_;
+		return output;
+	}
+	Py_buffer view;
+	if (PyObject_GetBuffer(_Object, &view, PyBUF_SIMPLE) < 0)
+		return NULL;
+	unsigned char* output = (unsigned char*)malloc((size_t)view.len + 1);
+	if (output) {
+		memcpy(output, view.buf, (size_t)view.len);
+		*_Size = (unsigned long long)view.len;
+	}
+	else {
+		PyErr_NoMemory();
+	}
+	PyBuffer_Release(&view);
+	return output;
 }
 
 static PyObject* EBoxPY_Bytes_CopyTo(PEBoxPY_Bytes self, PyObject* args) {
@@ -806,6 +1641,12 @@ static PyObject* EBoxPY_Bytes_CopyFrom(PEBoxPY_Bytes self, PyObject* args) {
 #define EBOXPY_BREAK_WRITE 0b01
 #define EBOXPY_BREAK_ACCESS 0b11
 
+#define EBOXPY_CONTEXT_INTEGER 0b0001
+#define EBOXPY_CONTEXT_CONTROL 0b0010
+#define EBOXPY_CONTEXT_DEBUG 0b0100
+#define EBOXPY_CONTEXT_FLOATING 0b1000
+#define EBOXPY_CONTEXT_ALL 0b1111
+
 PyDoc_STRVAR(EBoxPY_Thread__doc__, "EBoxPY Thread object, defines a running Thread within a Process.");
 
 typedef struct EBoxPY_Thread_T {
@@ -818,6 +1659,7 @@ typedef struct EBoxPY_Thread_T {
 	//
 	char IsLocked_;
 	PyObject* Registers_;
+	unsigned long Classes_;
 	//
 	CONTEXT Save_;
 	//
@@ -828,10 +1670,11 @@ static PyObject* EBoxPY_Thread_repr(PyObject* self);
 
 static PyObject* EBoxPY_Thread_Open(PEBoxPY_Thread self);
 static PyObject* EBoxPY_Thread_Close(PEBoxPY_Thread self);
-static PyObject* EBoxPY_Thread_Lock(PEBoxPY_Thread self);
+static PyObject* EBoxPY_Thread_Lock(PEBoxPY_Thread self, PyObject* args);
 static PyObject* EBoxPY_Thread_Unlock(PEBoxPY_Thread self);
 static PyObject* EBoxPY_Thread_SetBreakpoint(PEBoxPY_Thread self, PyObject* args);
 static PyObject* EBoxPY_Thread_RemoveBreakpoint(PEBoxPY_Thread self, PyObject* index);
+static PyObject* EBoxPY_Thread_GetStack(PEBoxPY_Thread self, PyObject* args);
 
 static PyMemberDef EBoxPY_Thread_Members[] = {
 	{"Thread_", T_ULONGLONG, offsetof(EBoxPY_Thread, Thread_), READONLY, PyDoc_STR("The Handle to the Thread.")},
@@ -839,16 +1682,18 @@ static PyMemberDef EBoxPY_Thread_Members[] = {
 	{"ID_", T_ULONG, offsetof(EBoxPY_Thread, ID_), READONLY, PyDoc_STR("The ID of the Thread.")},
 	{"IsLocked_", T_BOOL, offsetof(EBoxPY_Thread, IsLocked_), READONLY, PyDoc_STR("True if the Thread is Locked, False if not, defines the validity of the Thread Registers.")},
 	{"Registers_", T_OBJECT, offsetof(EBoxPY_Thread, Registers_), READONLY, PyDoc_STR("The Registers of the Thread.")},
+	{"Classes_", T_ULONG, offsetof(EBoxPY_Thread, Classes_), READONLY, PyDoc_STR("The Register classes held while Locked, see EBoxPY.INTEGER, CONTROL, DEBUG, FLOATING.")},
 	{NULL}
 };
 
 static PyMethodDef EBoxPY_Thread_Methods[] = {
 	{"Open", (PyCFunction)EBoxPY_Thread_Open, METH_NOARGS, PyDoc_STR("EBoxPY.Thread.Open()\nOpens the Thread if it is not already open.")},
 	{"Close", (PyCFunction)EBoxPY_Thread_Close, METH_NOARGS, PyDoc_STR("EBoxPY.Thread.Close()\nCloses the Thread, Closes the Handle.")},
-	{"Lock", (PyCFunction)EBoxPY_Thread_Lock, METH_NOARGS, PyDoc_STR("EBoxPY.Thread.Lock()\nLocks the Thread, sets the Registers.")},
+	{"Lock", (PyCFunction)EBoxPY_Thread_Lock, METH_VARARGS, PyDoc_STR("EBoxPY.Thread.Lock(_Classes=EBoxPY.ALL)\nLocks the Thread, sets the Registers of the requested classes only.")},
 	{"Unlock", (PyCFunction)EBoxPY_Thread_Unlock, METH_NOARGS, PyDoc_STR("EBoxPY.Thread.Unlock()\nUnlocks the Thread.")},
-	{"SetBreakpoint", (PyCFunction)EBoxPY_Thread_SetBreakpoint, METH_VARARGS, PyDoc_STR("EBoxPY.Thread.SetBreakpoint(_Index, _Address, _Condition)\nInserts a Hardware Breakpoint at the given Index in the Context.")},
+	{"SetBreakpoint", (PyCFunction)EBoxPY_Thread_SetBreakpoint, METH_VARARGS, PyDoc_STR("EBoxPY.Thread.SetBreakpoint(_Index, _Address, _Condition, _Length=1)\nInserts a Hardware Breakpoint at the given Index in the Context, watching _Length bytes for EBoxPY.ACCESS and WRITE.")},
 	{"RemoveBreakpoint", (PyCFunction)EBoxPY_Thread_RemoveBreakpoint, METH_O, PyDoc_STR("EBoxPY.Thread.RemoveBreakpoint(_Index)\nRemoves the Hardware Breakpoint at the given Index in the Context.")},
+	{"GetStack", (PyCFunction)EBoxPY_Thread_GetStack, METH_VARARGS, PyDoc_STR("EBoxPY.Thread.GetStack(_Process, _Maximum=64) -> [ (Address, Module, Offset), ... ]\nUnwinds the Locked Context natively using the .pdata unwind info of each Module, falling back to the RBP chain for code outside any Module.\nRequires EBoxPY.INTEGER and CONTROL, Module and Offset are None for addresses outside any Module.\n_Process is the open EBoxPY.Process owning the Thread, a Thread keeps only its own handle and the unwind cache lives on the Process.")},
 	{NULL}
 };
 
@@ -869,6 +1714,11 @@ static int _EBoxPY_Initialize_Thread(PyObject* self) {
 	PyModule_AddIntConstant(self, "EXECUTE", EBOXPY_BREAK_EXECUTE);
 	PyModule_AddIntConstant(self, "WRITE", EBOXPY_BREAK_WRITE);
 	PyModule_AddIntConstant(self, "ACCESS", EBOXPY_BREAK_ACCESS);
+	PyModule_AddIntConstant(self, "INTEGER", EBOXPY_CONTEXT_INTEGER);
+	PyModule_AddIntConstant(self, "CONTROL", EBOXPY_CONTEXT_CONTROL);
+	PyModule_AddIntConstant(self, "DEBUG", EBOXPY_CONTEXT_DEBUG);
+	PyModule_AddIntConstant(self, "FLOATING", EBOXPY_CONTEXT_FLOATING);
+	PyModule_AddIntConstant(self, "ALL", EBOXPY_CONTEXT_ALL);
 	if (PyType_Ready(&EBoxPY_Thread_Type) < 0)
 		return 0;
 	PyModule_AddObject(self, "Thread", (PyObject*)&EBoxPY_Thread_Type);
@@ -966,50 +1816,51 @@ typedef struct _EBoxPY_Thread_Register_T {
 	const char* Public_;
 	unsigned long long Private_;
 	unsigned long long Size_;
+	unsigned long Class_;
 } _EBoxPY_Thread_Register, *_PEBoxPY_Thread_Register;
 
-#define EBOXPY_THREAD_CREATE_REGISTER(_Public, _Private) { #_Public, (unsigned long long)offsetof(CONTEXT, _Private), sizeof(((CONTEXT*)0)->_Private) }
+#define EBOXPY_THREAD_CREATE_REGISTER(_Public, _Private, _Class) { #_Public, (unsigned long long)offsetof(CONTEXT, _Private), sizeof(((CONTEXT*)0)->_Private), EBOXPY_CONTEXT_##_Class }
 
 static _EBoxPY_Thread_Register _EBoxPY_Thread_Register_List[] = {
-	EBOXPY_THREAD_CREATE_REGISTER(RAX, Rax),
-	EBOXPY_THREAD_CREATE_REGISTER(RBX, Rbx),
-	EBOXPY_THREAD_CREATE_REGISTER(RCX, Rcx),
-	EBOXPY_THREAD_CREATE_REGISTER(RDX, Rdx),
-	EBOXPY_THREAD_CREATE_REGISTER(RSI, Rsi),
-	EBOXPY_THREAD_CREATE_REGISTER(RDI, Rdi),
-	EBOXPY_THREAD_CREATE_REGISTER(RSP, Rsp),
-	EBOXPY_THREAD_CREATE_REGISTER(RBP, Rbp),
-	EBOXPY_THREAD_CREATE_REGISTER(R8, R8),
-	EBOXPY_THREAD_CREATE_REGISTER(R9, R8),
-	EBOXPY_THREAD_CREATE_REGISTER(R10, R10),
-	EBOXPY_THREAD_CREATE_REGISTER(R11, R11),
-	EBOXPY_THREAD_CREATE_REGISTER(R12, R12),
-	EBOXPY_THREAD_CREATE_REGISTER(R13, R13),
-	EBOXPY_THREAD_CREATE_REGISTER(R14, R14),
-	EBOXPY_THREAD_CREATE_REGISTER(R15, R15),
-	EBOXPY_THREAD_CREATE_REGISTER(RIP, Rip),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM0, Xmm0),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM1, Xmm1),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM2, Xmm2),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM3, Xmm3),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM4, Xmm4),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM5, Xmm5),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM6, Xmm6),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM7, Xmm7),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM8, Xmm8),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM9, Xmm9),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM10, Xmm10),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM11, Xmm11),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM12, Xmm12),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM13, Xmm13),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM14, Xmm14),
-	EBOXPY_THREAD_CREATE_REGISTER(XMM15, Xmm15),
-	EBOXPY_THREAD_CREATE_REGISTER(DR0, Dr0),
-	EBOXPY_THREAD_CREATE_REGISTER(DR1, Dr1),
-	EBOXPY_THREAD_CREATE_REGISTER(DR2, Dr2),
-	EBOXPY_THREAD_CREATE_REGISTER(DR3, Dr3),
-	EBOXPY_THREAD_CREATE_REGISTER(DR6, Dr6),
-	EBOXPY_THREAD_CREATE_REGISTER(DR7, Dr7),
+	EBOXPY_THREAD_CREATE_REGISTER(RAX, Rax, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(RBX, Rbx, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(RCX, Rcx, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(RDX, Rdx, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(RSI, Rsi, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(RDI, Rdi, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(RSP, Rsp, CONTROL),
+	EBOXPY_THREAD_CREATE_REGISTER(RBP, Rbp, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(R8, R8, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(R9, R9, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(R10, R10, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(R11, R11, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(R12, R12, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(R13, R13, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(R14, R14, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(R15, R15, INTEGER),
+	EBOXPY_THREAD_CREATE_REGISTER(RIP, Rip, CONTROL),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM0, Xmm0, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM1, Xmm1, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM2, Xmm2, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM3, Xmm3, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM4, Xmm4, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM5, Xmm5, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM6, Xmm6, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM7, Xmm7, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM8, Xmm8, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM9, Xmm9, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM10, Xmm10, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM11, Xmm11, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM12, Xmm12, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM13, Xmm13, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM14, Xmm14, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(XMM15, Xmm15, FLOATING),
+	EBOXPY_THREAD_CREATE_REGISTER(DR0, Dr0, DEBUG),
+	EBOXPY_THREAD_CREATE_REGISTER(DR1, Dr1, DEBUG),
+	EBOXPY_THREAD_CREATE_REGISTER(DR2, Dr2, DEBUG),
+	EBOXPY_THREAD_CREATE_REGISTER(DR3, Dr3, DEBUG),
+	EBOXPY_THREAD_CREATE_REGISTER(DR6, Dr6, DEBUG),
+	EBOXPY_THREAD_CREATE_REGISTER(DR7, Dr7, DEBUG),
 	{NULL}
 };
 
@@ -1048,9 +1899,27 @@ static int _EBoxPY_Thread_Get_Register(PyObject* _Registers, _PEBoxPY_Thread_Reg
 	return 1;
 }
 
-static int _EBoxPY_Thread_Add_Context(PyObject* _Registers, CONTEXT* _Context) {
+// Maps EBoxPY.INTEGER, CONTROL, DEBUG, FLOATING to the CONTEXT flags that fetch them.
+static unsigned long _EBoxPY_Thread_Context_Flags(unsigned long _Classes) {
+	if ((_Classes & EBOXPY_CONTEXT_ALL) == EBOXPY_CONTEXT_ALL)
+		return CONTEXT_ALL;
+	unsigned long flags = 0;
+	if (_Classes & EBOXPY_CONTEXT_INTEGER)
+		flags |= CONTEXT_INTEGER;
+	if (_Classes & EBOXPY_CONTEXT_CONTROL)
+		flags |= CONTEXT_CONTROL;
+	if (_Classes & EBOXPY_CONTEXT_DEBUG)
+		flags |= CONTEXT_DEBUG_REGISTERS;
+	if (_Classes & EBOXPY_CONTEXT_FLOATING)
+		flags |= CONTEXT_FLOATING_POINT;
+	return flags;
+}
+
+static int _EBoxPY_Thread_Add_Context(PyObject* _Registers, CONTEXT* _Context, unsigned long _Classes) {
 	PyDict_Clear(_Registers);
 	for (_PEBoxPY_Thread_Register i = _EBoxPY_Thread_Register_List; i->Public_ != NULL; ++i) {
+		if (!(i->Class_ & _Classes))
+			continue;
 		if (!_EBoxPY_Thread_Add_Register(_Registers, i, _Context)) {
 			PyDict_Clear(_Registers);
 			return 0;
@@ -1059,8 +1928,10 @@ static int _EBoxPY_Thread_Add_Context(PyObject* _Registers, CONTEXT* _Context) {
 	return 1;
 }
 
-static int _EBoxPY_Thread_Get_Context(PyObject* _Registers, CONTEXT* _Context) {
+static int _EBoxPY_Thread_Get_Context(PyObject* _Registers, CONTEXT* _Context, unsigned long _Classes) {
 	for (_PEBoxPY_Thread_Register i = _EBoxPY_Thread_Register_List; i->Public_ != NULL; ++i) {
+		if (!(i->Class_ & _Classes))
+			continue;
 		if (!_EBoxPY_Thread_Get_Register(_Registers, i, _Context)) {
 			return 0;
 		}
@@ -1068,7 +1939,7 @@ static int _EBoxPY_Thread_Get_Context(PyObject* _Registers, CONTEXT* _Context) {
 	return 1;
 }
 
-static PyObject* EBoxPY_Thread_Lock(PEBoxPY_Thread self) {
+static PyObject* _EBoxPY_Thread_Lock(PEBoxPY_Thread self, unsigned long _Classes) {
 	if (!self->IsOpen_) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread.IsOpen_ was False.");
 		return NULL;
@@ -1081,22 +1952,34 @@ static PyObject* EBoxPY_Thread_Lock(PEBoxPY_Thread self) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread Failed to Suspend Thread.");
 		return NULL;
 	}
-	self->Save_.ContextFlags = CONTEXT_ALL;
+	self->Save_.ContextFlags = _EBoxPY_Thread_Context_Flags(_Classes);
 	if (!GetThreadContext(self->Thread_, &self->Save_)) {
 		ResumeThread(self->Thread_);
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread Failed to Read Thread Context.");
 		return NULL;
 	}
-	if (!_EBoxPY_Thread_Add_Context(self->Registers_, &self->Save_)) {
+	if (!_EBoxPY_Thread_Add_Context(self->Registers_, &self->Save_, _Classes)) {
 		ResumeThread(self->Thread_);
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread Failed to Add Thread Context.");
 		return NULL;
 	}
+	self->Classes_ = _Classes;
 	self->IsLocked_ = 1;
 	Py_INCREF(Py_None);
 	return Py_None;
 }
 
+static PyObject* EBoxPY_Thread_Lock(PEBoxPY_Thread self, PyObject* args) {
+	unsigned long classes = EBOXPY_CONTEXT_ALL;
+	if (!PyArg_ParseTuple(args, "|k", &classes))
+		return NULL;
+	if (!(classes & EBOXPY_CONTEXT_ALL) || (classes & ~(unsigned long)EBOXPY_CONTEXT_ALL)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread.Lock requires _Classes to be a combination of EBoxPY.INTEGER, CONTROL, DEBUG, FLOATING or ALL.");
+		return NULL;
+	}
+	return _EBoxPY_Thread_Lock(self, classes);
+}
+
 static PyObject* EBoxPY_Thread_Unlock(PEBoxPY_Thread self) {
 	if (!self->IsOpen_) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread.IsOpen_ was False.");
@@ -1106,8 +1989,8 @@ static PyObject* EBoxPY_Thread_Unlock(PEBoxPY_Thread self) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread.IsLocked_ was already False.");
 		return NULL;
 	}
-	self->Save_.ContextFlags = CONTEXT_ALL;
-	if (!_EBoxPY_Thread_Get_Context(self->Registers_, &self->Save_)) {
+	self->Save_.ContextFlags = _EBoxPY_Thread_Context_Flags(self->Classes_);
+	if (!_EBoxPY_Thread_Get_Context(self->Registers_, &self->Save_, self->Classes_)) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread Failed to Get Context from Dictionary.");
 		return NULL;
 	}
@@ -1122,18 +2005,56 @@ static PyObject* EBoxPY_Thread_Unlock(PEBoxPY_Thread self) {
 	return Py_None;
 }
 
-#define EBOXPY_BREAKPOINT(_Index, _Condition) ((1 << (2 * _Index)) | (_Condition << (16 + (4 * _Index))))
-#define EBOXPY_BREAKPOINT_MASK(_Index) EBOXPY_BREAKPOINT(_Index, 0b11)
+#define EBOXPY_BREAKPOINT(_Index, _Condition) ((1ull << (2 * (_Index))) | ((unsigned long long)(_Condition) << (16 + (4 * (_Index)))))
+#define EBOXPY_BREAKPOINT_MASK(_Index) EBOXPY_BREAKPOINT(_Index, 0b1111)
+
+// DR7 encodes the watched Length as 1 -> 0b00, 2 -> 0b01, 8 -> 0b10, 4 -> 0b11 above the condition bits.
+static int _EBoxPY_Breakpoint_Length(unsigned long long _Length, unsigned long long* _Bits) {
+	switch (_Length) {
+	case 1: *_Bits = 0b00; return 1;
+	case 2: *_Bits = 0b01; return 1;
+	case 8: *_Bits = 0b10; return 1;
+	case 4: *_Bits = 0b11; return 1;
+	}
+	return 0;
+}
+
+// A Breakpoint applied to every Thread of a Process, Control_ holds its DR7 bits and is 0 when unset.
+typedef struct _EBoxPY_Breakpoint_T {
+	unsigned long long Address_;
+	unsigned long long Control_;
+} _EBoxPY_Breakpoint, *_PEBoxPY_Breakpoint;
+
+// Touches only the debug registers, for each Index set in _Mask.
+static int _EBoxPY_Breakpoint_Apply(HANDLE _Thread, const _EBoxPY_Breakpoint* _Breakpoints, unsigned long _Mask) {
+	CONTEXT context;
+	context.ContextFlags = CONTEXT_DEBUG_REGISTERS;
+	if (!GetThreadContext(_Thread, &context))
+		return 0;
+	for (unsigned long i = 0; i < 4; ++i) {
+		if (!(_Mask & (1 << i)))
+			continue;
+		(&context.Dr0)[i] = _Breakpoints[i].Address_;
+		context.Dr7 &= ~EBOXPY_BREAKPOINT_MASK(i);
+		context.Dr7 |= _Breakpoints[i].Control_;
+	}
+	return SetThreadContext(_Thread, &context) != FALSE;
+}
 
 static PyObject* EBoxPY_Thread_SetBreakpoint(PEBoxPY_Thread self, PyObject* args) {
 	if (!self->IsLocked_) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread.IsLocked_ was False.");
 		return NULL;
 	}
+	if (!(self->Classes_ & EBOXPY_CONTEXT_DEBUG)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread was not Locked with EBoxPY.DEBUG.");
+		return NULL;
+	}
 	int index = 0;
 	PyObject* address = NULL;
 	int conditions = 0;
-	if (!PyArg_ParseTuple(args, "iOi", &index, &address, &conditions))
+	unsigned long long length = 1;
+	if (!PyArg_ParseTuple(args, "iOi|K", &index, &address, &conditions, &length))
 		return NULL;
 	if (!PyLong_Check(address)){
 		PyErr_SetString(PyExc_TypeError, "EBoxPY.Thread Requires _Address to be int.");
@@ -1148,6 +2069,11 @@ static PyObject* EBoxPY_Thread_SetBreakpoint(PEBoxPY_Thread self, PyObject* args
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread Requires _Conditions to be EBoxPY.ACCESS, EXECUTE, WRITE");
 		return NULL;
 	}
+	unsigned long long bits = 0;
+	if (!_EBoxPY_Breakpoint_Length(length, &bits) || (conditions == EBOXPY_BREAK_EXECUTE && length != 1)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread Requires _Length to be 1, 2, 4 or 8, and 1 for EBoxPY.EXECUTE.");
+		return NULL;
+	}
 	char DRX[8] = {0};
 	sprintf(DRX, "DR%i", index);
 	PEBoxPY_Bytes _DRX = NULL;
@@ -1164,7 +2090,7 @@ static PyObject* EBoxPY_Thread_SetBreakpoint(PEBoxPY_Thread self, PyObject* args
 	unsigned long long* __DR7 = (unsigned long long*)_DR7->Allocation_;
 	*__DRX = _address;
 	*__DR7 &= ~EBOXPY_BREAKPOINT_MASK(index);
-	*__DR7 |= EBOXPY_BREAKPOINT(index, conditions);
+	*__DR7 |= EBOXPY_BREAKPOINT(index, conditions | (bits << 2));
 	Py_INCREF(Py_None);
 	return Py_None;
 }
@@ -1174,6 +2100,10 @@ static PyObject* EBoxPY_Thread_RemoveBreakpoint(PEBoxPY_Thread self, PyObject* i
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread.IsLocked_ was False.");
 		return NULL;
 	}
+	if (!(self->Classes_ & EBOXPY_CONTEXT_DEBUG)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread was not Locked with EBoxPY.DEBUG.");
+		return NULL;
+	}
 	if (!PyLong_Check(index)) {
 		PyErr_SetString(PyExc_TypeError, "EBoxPY.Thread Requires _Index to be int.");
 		return NULL;
@@ -1205,619 +2135,8065 @@ static PyObject* EBoxPY_Thread_RemoveBreakpoint(PEBoxPY_Thread self, PyObject* i
 
 /*
  *
- * EBoxPY.Process
+ * EBoxPY Dump
  *
  */
 
-PyDoc_STRVAR(EBoxPY_Process__doc__, "EBoxPY Process object, defines a running Process.");
+#define EBOXPY_DUMP_MAGIC 0x44584245
+#define EBOXPY_DUMP_VERSION 1
+#define EBOXPY_DUMP_CHUNK 0x100000
+#define EBOXPY_DUMP_ALIGNMENT 0x1000
+#define EBOXPY_DUMP_CACHE 4
+#define EBOXPY_DUMP_WORKERS 8
 
-typedef struct EBoxPY_Process_T {
+#define EBOXPY_DUMP_COMPRESSED 1
+
+#define EBOXPY_DUMP_READABLE (EBOXPY_REGION_READABLE | PAGE_WRITECOPY | PAGE_EXECUTE_WRITECOPY)
+
+#define EBOXPY_COMPRESSION_FORMAT (0x0002 | 0x0000) // COMPRESSION_FORMAT_LZNT1 | COMPRESSION_ENGINE_STANDARD
+
+typedef long (WINAPI* _EBoxPY_RtlGetCompressionWorkSpaceSize)(unsigned short, unsigned long*, unsigned long*);
+typedef long (WINAPI* _EBoxPY_RtlCompressBuffer)(unsigned short, unsigned char*, unsigned long, unsigned char*, unsigned long, unsigned long, unsigned long*, void*);
+typedef long (WINAPI* _EBoxPY_RtlDecompressBuffer)(unsigned short, unsigned char*, unsigned long, unsigned char*, unsigned long, unsigned long*);
+
+typedef struct _EBoxPY_Dump_Header_T {
+	unsigned int Magic_;
+	unsigned int Version_;
+	unsigned int Flags_;
+	unsigned int Architecture_;
+	unsigned int ID_;
+	unsigned int ChunkSize_;
 	//
-	PyObject_HEAD
+	unsigned long long RegionCount_;
+	unsigned long long RegionOffset_;
+	unsigned long long ChunkCount_;
+	unsigned long long ChunkOffset_;
+	unsigned long long ModuleCount_;
+	unsigned long long ModuleOffset_;
+	unsigned long long ThreadCount_;
+	unsigned long long ThreadOffset_;
 	//
-	HANDLE Process_;
-	char IsOpen_;
-	unsigned long ID_;
+	wchar_t Name_[MAX_PATH];
+} _EBoxPY_Dump_Header, *_PEBoxPY_Dump_Header;
+
+typedef struct _EBoxPY_Dump_Region_T {
+	unsigned long long Allocation_;
+	unsigned long long Address_;
+	unsigned long long Size_;
 	//
-	PyObject* Name_;
+	unsigned int Protection_;
+	unsigned int State_;
+	unsigned int Type_;
+	unsigned int Backed_;
 	//
-} EBoxPY_Process, *PEBoxPY_Process;
+	unsigned long long Chunk_;
+	unsigned long long ChunkCount_;
+} _EBoxPY_Dump_Region, *_PEBoxPY_Dump_Region;
 
-static void EBoxPY_Process_dealloc(PyObject* self);
-static PyObject* EBoxPY_Process_repr(PyObject* self);
+// A Chunk with Size_ == 0 could not be Read at Dump time.
+typedef struct _EBoxPY_Dump_Chunk_T {
+	unsigned long long Offset_;
+	unsigned int Size_;
+	unsigned int Flags_;
+} _EBoxPY_Dump_Chunk, *_PEBoxPY_Dump_Chunk;
 
-static PyObject* EBoxPY_Process_Open(PEBoxPY_Process self);
-static PyObject* EBoxPY_Process_Close(PEBoxPY_Process self);
-static PyObject* EBoxPY_Process_GetModules(PEBoxPY_Process self);
-static PyObject* EBoxPY_Process_GetRegion(PEBoxPY_Process self, PyObject* address);
-static PyObject* EBoxPY_Process_ReadTo(PEBoxPY_Process self, PyObject* args);
-static PyObject* EBoxPY_Process_WriteFrom(PEBoxPY_Process self, PyObject* args);
-static PyObject* EBoxPY_Process_GetThreads(PEBoxPY_Process self);
-static PyObject* EBoxPY_Process_Allocate(PEBoxPY_Process self, PyObject* args);
-static PyObject* EBoxPY_Process_Free(PEBoxPY_Process self, PyObject* allocation);
-static PyObject* EBoxPY_Process_IsI386(PEBoxPY_Process self);
-static PyObject* EBoxPY_Process_IsAMD64(PEBoxPY_Process self);
+typedef struct _EBoxPY_Dump_Module_T {
+	unsigned long long Address_;
+	unsigned long long Size_;
+	wchar_t Name_[256];
+	wchar_t Path_[MAX_PATH];
+} _EBoxPY_Dump_Module, *_PEBoxPY_Dump_Module;
 
-static PyMemberDef EBoxPY_Process_Members[] = {
-	{"Process_", T_ULONGLONG, offsetof(EBoxPY_Process, Process_), READONLY, PyDoc_STR("The Handle to the Process.")},
-	{"IsOpen_", T_BOOL, offsetof(EBoxPY_Process, IsOpen_), READONLY, PyDoc_STR("True if the Process is Open, False if not, defines validity of the Process Handle.")},
-	{"ID_", T_ULONG, offsetof(EBoxPY_Process, ID_), READONLY, PyDoc_STR("The ID of the Process.")},
-	{"Name_", T_OBJECT, offsetof(EBoxPY_Process, Name_), READONLY, PyDoc_STR("The Name of the Process, *.exe etc.")},
-	{NULL}
-};
+typedef struct _EBoxPY_Dump_Thread_T {
+	unsigned int ID_;
+	unsigned int Valid_;
+	CONTEXT Context_;
+} _EBoxPY_Dump_Thread, *_PEBoxPY_Dump_Thread;
 
-static PyMethodDef EBoxPY_Process_Methods[] = {
-	{"Open", (PyCFunction)EBoxPY_Process_Open, METH_NOARGS, PyDoc_STR("EBoxPY.Process.Open()\nOpens the Process if it is not already open.")},
-	{"Close", (PyCFunction)EBoxPY_Process_Close, METH_NOARGS, PyDoc_STR("EBoxPY.Process.Close()\nCloses the Process, Closes the Handle.")},
-	{"GetModules", (PyCFunction)EBoxPY_Process_GetModules, METH_NOARGS, PyDoc_STR("EBoxPY.Process.GetModules() -> { \"*.dll\" : EBoxPY.Module(...), ... }\nRetrieves a dictionary of Modules currently loaded in the Process.")},
-	{"GetRegion", (PyCFunction)EBoxPY_Process_GetRegion, METH_O, PyDoc_STR("EBoxPY.Process.GetRegion(_Address) -> EBoxPY.Region\nGets the Region at the specified Address.")},
-	{"ReadTo", (PyCFunction)EBoxPY_Process_ReadTo, METH_VARARGS, PyDoc_STR("EBoxPY.Process.ReadTo(_Address, _Bytes, _Start, _Size)\nReads Bytes from Address into specified Bytes object.")},
-	{"WriteFrom", (PyCFunction)EBoxPY_Process_WriteFrom, METH_VARARGS, PyDoc_STR("EBoxPY.Process.WriteFrom(_Address, _Bytes, _Start, _Size)\nWrites Bytes to specified Address.")},
-	{"GetThreads", (PyCFunction)EBoxPY_Process_GetThreads, METH_NOARGS, PyDoc_STR("EBoxPY.Process.GetThreads() -> [ EBoxPY.Thread(...), ... ]\nRetrieves a list of Threads running in the Process.")},
-	{"Allocate", (PyCFunction)EBoxPY_Process_Allocate, METH_VARARGS, PyDoc_STR("EBoxPY.Process.Allocate(_Size, _Address=None, _Range=None) -> int\nAllocates Memory in the Process with a given Size + Location options.")},
-	{"Free", (PyCFunction)EBoxPY_Process_Free, METH_O, PyDoc_STR("EBoxPY.Process.Free(_Allocation)\nFrees Memory in a Process.")},
-	{"IsI386", (PyCFunction)EBoxPY_Process_IsI386, METH_NOARGS, PyDoc_STR("EBoxPY.Process.IsI386() -> bool\nTrue if the Process is 32 bit, False otherwise.")},
-	{"IsAMD64", (PyCFunction)EBoxPY_Process_IsAMD64, METH_NOARGS, PyDoc_STR("EBoxPY.Process.IsAMD64() -> bool\nTrue if the Process is 64 bit, False otherwise.")},
-	{NULL}
-};
+typedef struct _EBoxPY_Dump_T {
+	HANDLE File_;
+	HANDLE Mapping_;
+	unsigned char* View_;
+	unsigned long long Size_;
+	//
+	_PEBoxPY_Dump_Header Header_;
+	_PEBoxPY_Dump_Region Regions_;
+	_PEBoxPY_Dump_Chunk Chunks_;
+	_PEBoxPY_Dump_Module Modules_;
+	_PEBoxPY_Dump_Thread Threads_;
+	//
+	SRWLOCK Lock_;
+	unsigned long long CacheChunk_[EBOXPY_DUMP_CACHE];
+	unsigned char* Cache_[EBOXPY_DUMP_CACHE];
+	unsigned long CacheNext_;
+} _EBoxPY_Dump, *_PEBoxPY_Dump;
 
-static PyTypeObject EBoxPY_Process_Type = {
-	PyObject_HEAD_INIT(NULL)
-	.tp_name = "EBoxPY.Process",
-	.tp_basicsize = sizeof(EBoxPY_Process),
-	.tp_doc = EBoxPY_Process__doc__,
-	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
-	.tp_members = EBoxPY_Process_Members,
-	.tp_dealloc = EBoxPY_Process_dealloc,
-	.tp_repr = EBoxPY_Process_repr,
-	.tp_str = EBoxPY_Process_repr,
-	.tp_methods = EBoxPY_Process_Methods,
-};
+static FARPROC _EBoxPY_Ntdll(const char* _Name) {
+	HMODULE ntdll = GetModuleHandleW(L"ntdll.dll");
+	if (!ntdll)
+		return NULL;
+	return GetProcAddress(ntdll, _Name);
+}
 
-static int _EBoxPY_Initialize_Process(PyObject* self) {
-	if (PyType_Ready(&EBoxPY_Process_Type) < 0)
-		return 0;
-	PyModule_AddObject(self, "Process", (PyObject*)&EBoxPY_Process_Type);
+static int _EBoxPY_File_Write(HANDLE _File, unsigned long long _Offset, const void* _Data, unsigned long long _Size) {
+	while (_Size) {
+		DWORD size = (DWORD)(_Size > 0x40000000 ? 0x40000000 : _Size);
+		DWORD written = 0;
+		OVERLAPPED overlapped = {0};
+		overlapped.Offset = (DWORD)(_Offset & 0xFFFFFFFF);
+		overlapped.OffsetHigh = (DWORD)(_Offset >> 32);
+		if (!WriteFile(_File, _Data, size, &written, &overlapped) || written != size)
+			return 0;
+		_Data = (const char*)_Data + size;
+		_Offset += size;
+		_Size -= size;
+	}
 	return 1;
 }
 
-static PyObject* _EBoxPY_Create_Process(PROCESSENTRY32W _Entry) {
-	PyObject* output = EBoxPY_Process_Type.tp_alloc(&EBoxPY_Process_Type, 1);
-	if (!output)
-		return NULL;
-	EBOXPY_OBJECT_ZERO(EBoxPY_Process, output);
-	PEBoxPY_Process process = (PEBoxPY_Process)output;
-	process->Process_ = NULL;
-	process->IsOpen_ = (char)0;
-	process->ID_ = (unsigned long)_Entry.th32ProcessID;
-	process->Name_ = PyUnicode_FromWideChar(_Entry.szExeFile, -1);
-	if (!process->Name_) {
-		Py_DECREF(output);
-		return NULL;
+/*
+ * Writing: the calling Thread Reads each Chunk into a free buffer and queues it, workers compress it,
+ * reserve the next file offset and write it positionally, so writes complete in any order.
+ */
+
+typedef struct _EBoxPY_Dump_Job_T {
+	unsigned char* Buffer_;
+	unsigned long Size_;
+	unsigned long long Chunk_;
+	char Valid_;
+} _EBoxPY_Dump_Job, *_PEBoxPY_Dump_Job;
+
+typedef struct _EBoxPY_Dump_Writer_T {
+	HANDLE File_;
+	char Compress_;
+	volatile LONG64 Offset_;
+	volatile LONG Failed_;
+	_PEBoxPY_Dump_Chunk Chunks_;
+	//
+	CRITICAL_SECTION Lock_;
+	HANDLE Filled_;
+	HANDLE Empty_;
+	_EBoxPY_Dump_Job Jobs_[4 * EBOXPY_DUMP_WORKERS];
+	unsigned long Head_;
+	unsigned long Tail_;
+	unsigned char* Free_[2 * EBOXPY_DUMP_WORKERS];
+	unsigned long FreeCount_;
+	//
+	_EBoxPY_RtlCompressBuffer Compress;
+	unsigned long WorkSpaceSize_;
+} _EBoxPY_Dump_Writer, *_PEBoxPY_Dump_Writer;
+
+static void _EBoxPY_Dump_Store(_PEBoxPY_Dump_Writer _Writer, _PEBoxPY_Dump_Job _Job, void* _WorkSpace, unsigned char* _Scratch) {
+	_PEBoxPY_Dump_Chunk chunk = &_Writer->Chunks_[_Job->Chunk_];
+	if (!_Job->Valid_)
+		return;
+	unsigned char* data = _Job->Buffer_;
+	unsigned long size = _Job->Size_;
+	unsigned int flags = 0;
+	if (_Writer->Compress_ && _WorkSpace && _Scratch) {
+		unsigned long compressed = 0;
+		if (_Writer->Compress(EBOXPY_COMPRESSION_FORMAT, _Job->Buffer_, _Job->Size_, _Scratch, EBOXPY_DUMP_CHUNK, 0x1000, &compressed, _WorkSpace) >= 0 && compressed && compressed < _Job->Size_) {
+			data = _Scratch;
+			size = compressed;
+			flags = EBOXPY_DUMP_COMPRESSED;
+		}
+	}
+	unsigned long long offset = (unsigned long long)InterlockedExchangeAdd64(&_Writer->Offset_, (LONG64)size);
+	if (!_EBoxPY_File_Write(_Writer->File_, offset, data, size)) {
+		InterlockedExchange(&_Writer->Failed_, 1);
+		return;
+	}
+	chunk->Offset_ = offset;
+	chunk->Size_ = size;
+	chunk->Flags_ = flags;
+}
+
+static void _EBoxPY_Dump_Writer_Push(_PEBoxPY_Dump_Writer _Writer, _PEBoxPY_Dump_Job _Job) {
+	EnterCriticalSection(&_Writer->Lock_);
+	_Writer->Jobs_[_Writer->Tail_++ % (4 * EBOXPY_DUMP_WORKERS)] = *_Job;
+	LeaveCriticalSection(&_Writer->Lock_);
+	ReleaseSemaphore(_Writer->Filled_, 1, NULL);
+}
+
+static unsigned char* _EBoxPY_Dump_Writer_Buffer(_PEBoxPY_Dump_Writer _Writer) {
+	WaitForSingleObject(_Writer->Empty_, INFINITE);
+	EnterCriticalSection(&_Writer->Lock_);
+	unsigned char* buffer = _Writer->Free_[--_Writer->FreeCount_];
+	LeaveCriticalSection(&_Writer->Lock_);
+	return buffer;
+}
+
+static DWORD WINAPI _EBoxPY_Dump_Worker(LPVOID _Context) {
+	_PEBoxPY_Dump_Writer writer = (_PEBoxPY_Dump_Writer)_Context;
+	void* workspace = (writer->Compress_ ? malloc(writer->WorkSpaceSize_ ? writer->WorkSpaceSize_ : 1) : NULL);
+	unsigned char* scratch = (writer->Compress_ ? (unsigned char*)malloc(EBOXPY_DUMP_CHUNK) : NULL);
+	for (;;) {
+		WaitForSingleObject(writer->Filled_, INFINITE);
+		EnterCriticalSection(&writer->Lock_);
+		_EBoxPY_Dump_Job job = writer->Jobs_[writer->Head_++ % (4 * EBOXPY_DUMP_WORKERS)];
+		LeaveCriticalSection(&writer->Lock_);
+		if (!job.Buffer_)
+			break;
+		_EBoxPY_Dump_Store(writer, &job, workspace, scratch);
+		EnterCriticalSection(&writer->Lock_);
+		writer->Free_[writer->FreeCount_++] = job.Buffer_;
+		LeaveCriticalSection(&writer->Lock_);
+		ReleaseSemaphore(writer->Empty_, 1, NULL);
+	}
+	free(workspace);
+	free(scratch);
+	return 0;
+}
+
+typedef struct _EBoxPY_Dump_Vector_T {
+	void* Data_;
+	unsigned long long Count_;
+	unsigned long long Capacity_;
+} _EBoxPY_Dump_Vector, *_PEBoxPY_Dump_Vector;
+
+static void* _EBoxPY_Dump_Vector_Add(_PEBoxPY_Dump_Vector _Vector, unsigned long long _Stride) {
+	if (_Vector->Count_ == _Vector->Capacity_) {
+		unsigned long long capacity = (_Vector->Capacity_ ? _Vector->Capacity_ * 2 : 64);
+		void* data = realloc(_Vector->Data_, capacity * _Stride);
+		if (!data)
+			return NULL;
+		_Vector->Data_ = data;
+		_Vector->Capacity_ = capacity;
 	}
+	void* output = (char*)_Vector->Data_ + _Vector->Count_++ * _Stride;
+	memset(output, 0, _Stride);
 	return output;
 }
 
-static PyObject* _EBoxPY_GetProcessNameFromID(unsigned long _ID) {
-	HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
-	if (!snapshot || snapshot == INVALID_HANDLE_VALUE) {
-		return NULL;
+static int _EBoxPY_Dump_Collect_Regions(HANDLE _Process, _PEBoxPY_Dump_Vector _Regions, unsigned long long* _ChunkCount) {
+	MEMORY_BASIC_INFORMATION information = {0};
+	unsigned long long chunks = 0;
+	for (unsigned long long address = 0; VirtualQueryEx(_Process, (void*)address, &information, sizeof(MEMORY_BASIC_INFORMATION)) != 0; address = (unsigned long long)information.BaseAddress + information.RegionSize) {
+		_PEBoxPY_Dump_Region region = (_PEBoxPY_Dump_Region)_EBoxPY_Dump_Vector_Add(_Regions, sizeof(_EBoxPY_Dump_Region));
+		if (!region)
+			return 0;
+		region->Allocation_ = (unsigned long long)information.AllocationBase;
+		region->Address_ = (unsigned long long)information.BaseAddress;
+		region->Size_ = (unsigned long long)information.RegionSize;
+		region->Protection_ = (unsigned int)information.Protect;
+		region->State_ = (unsigned int)information.State;
+		region->Type_ = (unsigned int)information.Type;
+		PSAPI_WORKING_SET_EX_INFORMATION set = {0};
+		set.VirtualAddress = information.BaseAddress;
+		if (QueryWorkingSetEx(_Process, &set, sizeof(PSAPI_WORKING_SET_EX_INFORMATION)))
+			region->Backed_ = (unsigned int)(set.VirtualAttributes.Valid ? 1 : 0);
+		if (information.State == MEM_COMMIT && (information.Protect & EBOXPY_DUMP_READABLE) && !(information.Protect & PAGE_GUARD)) {
+			region->Chunk_ = chunks;
+			region->ChunkCount_ = (region->Size_ + EBOXPY_DUMP_CHUNK - 1) / EBOXPY_DUMP_CHUNK;
+			chunks += region->ChunkCount_;
+		}
+		if (region->Size_ == 0)
+			break;
 	}
-	PROCESSENTRY32W entry = {0};
-	entry.dwSize = sizeof(PROCESSENTRY32W);
-	for (BOOL b = Process32FirstW(snapshot, &entry); b == TRUE; b = Process32NextW(snapshot, &entry)) {
-		if (entry.th32ProcessID == _ID) {
+	*_ChunkCount = chunks;
+	return 1;
+}
+
+static int _EBoxPY_Dump_Collect_Modules(unsigned long _ID, _PEBoxPY_Dump_Vector _Modules) {
+	HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPMODULE | TH32CS_SNAPMODULE32, (DWORD)_ID);
+	if (!snapshot || snapshot == INVALID_HANDLE_VALUE)
+		return 0;
+	MODULEENTRY32W entry = {0};
+	entry.dwSize = sizeof(MODULEENTRY32W);
+	for (BOOL b = Module32FirstW(snapshot, &entry); b == TRUE; b = Module32NextW(snapshot, &entry)) {
+		_PEBoxPY_Dump_Module _module = (_PEBoxPY_Dump_Module)_EBoxPY_Dump_Vector_Add(_Modules, sizeof(_EBoxPY_Dump_Module));
+		if (!_module) {
 			CloseHandle(snapshot);
-			return PyUnicode_FromWideChar(entry.szExeFile, -1);
+			return 0;
 		}
+		_module->Address_ = (unsigned long long)entry.modBaseAddr;
+		_module->Size_ = (unsigned long long)entry.modBaseSize;
+		memcpy(_module->Name_, entry.szModule, sizeof(_module->Name_));
+		memcpy(_module->Path_, entry.szExePath, sizeof(_module->Path_));
 	}
 	CloseHandle(snapshot);
-	return NULL;
+	return 1;
 }
 
-static PyObject* EBoxPY_StartProcess(PyObject* self, PyObject* args) {
-	if (PyTuple_Size(args) != 2) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.StartProcess Takes 2 Arguments.");
-		return NULL;
+static int _EBoxPY_Dump_Collect_Threads(unsigned long _ID, _PEBoxPY_Dump_Vector _Threads) {
+	HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
+	if (!snapshot || snapshot == INVALID_HANDLE_VALUE)
+		return 0;
+	THREADENTRY32 entry = {0};
+	entry.dwSize = sizeof(THREADENTRY32);
+	for (BOOL b = Thread32First(snapshot, &entry); b == TRUE; b = Thread32Next(snapshot, &entry)) {
+		if (entry.th32OwnerProcessID != _ID)
+			continue;
+		_PEBoxPY_Dump_Thread thread = (_PEBoxPY_Dump_Thread)_EBoxPY_Dump_Vector_Add(_Threads, sizeof(_EBoxPY_Dump_Thread));
+		if (!thread) {
+			CloseHandle(snapshot);
+			return 0;
+		}
+		thread->ID_ = (unsigned int)entry.th32ThreadID;
+		HANDLE handle = OpenThread(THREAD_GET_CONTEXT | THREAD_SUSPEND_RESUME | THREAD_QUERY_INFORMATION, FALSE, entry.th32ThreadID);
+		if (!handle)
+			continue;
+		if (SuspendThread(handle) != (DWORD)-1) {
+			CONTEXT context;
+			context.ContextFlags = CONTEXT_ALL;
+			if (GetThreadContext(handle, &context)) {
+				thread->Context_ = context;
+				thread->Valid_ = 1;
+			}
+			ResumeThread(handle);
+		}
+		CloseHandle(handle);
 	}
-	PyObject* _Executable = PyTuple_GetItem(args, 0);
-	PyObject* _Suspended = PyTuple_GetItem(args, 1);
-	if (!PyUnicode_Check(_Executable)) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.StartProcess Requires _Executable to be str.");
+	CloseHandle(snapshot);
+	return 1;
+}
+
+static int _EBoxPY_Dump_Create(HANDLE _Process, unsigned long _ID, const wchar_t* _Name, unsigned int _Architecture, const wchar_t* _Path, char _Compress) {
+	_EBoxPY_Dump_Vector regions = {0};
+	_EBoxPY_Dump_Vector modules = {0};
+	_EBoxPY_Dump_Vector threads = {0};
+	_EBoxPY_Dump_Writer writer;
+	memset(&writer, 0, sizeof(_EBoxPY_Dump_Writer));
+	unsigned long long chunks = 0;
+	int status = 0;
+	HANDLE workers[EBOXPY_DUMP_WORKERS] = {0};
+	unsigned long count = 0;
+	if (!_EBoxPY_Dump_Collect_Regions(_Process, &regions, &chunks) || !_EBoxPY_Dump_Collect_Modules(_ID, &modules) || !_EBoxPY_Dump_Collect_Threads(_ID, &threads))
+		goto cleanup;
+	writer.Chunks_ = (_PEBoxPY_Dump_Chunk)calloc(chunks + 1, sizeof(_EBoxPY_Dump_Chunk));
+	if (!writer.Chunks_)
+		goto cleanup;
+	writer.Compress_ = _Compress;
+	if (writer.Compress_) {
+		_EBoxPY_RtlGetCompressionWorkSpaceSize size = (_EBoxPY_RtlGetCompressionWorkSpaceSize)_EBoxPY_Ntdll("RtlGetCompressionWorkSpaceSize");
+		writer.Compress = (_EBoxPY_RtlCompressBuffer)_EBoxPY_Ntdll("RtlCompressBuffer");
+		unsigned long fragment = 0;
+		if (!size || !writer.Compress || size(EBOXPY_COMPRESSION_FORMAT, &writer.WorkSpaceSize_, &fragment) < 0)
+			writer.Compress_ = 0;
+	}
+	writer.File_ = CreateFileW(_Path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (writer.File_ == INVALID_HANDLE_VALUE) {
+		writer.File_ = NULL;
+		goto cleanup;
+	}
+	InitializeCriticalSection(&writer.Lock_);
+	writer.Filled_ = CreateSemaphoreW(NULL, 0, 4 * EBOXPY_DUMP_WORKERS, NULL);
+	writer.Empty_ = CreateSemaphoreW(NULL, 2 * EBOXPY_DUMP_WORKERS, 2 * EBOXPY_DUMP_WORKERS, NULL);
+	for (unsigned long i = 0; i < 2 * EBOXPY_DUMP_WORKERS; ++i) {
+		writer.Free_[i] = (unsigned char*)malloc(EBOXPY_DUMP_CHUNK);
+		if (writer.Free_[i])
+			writer.FreeCount_++;
+	}
+	if (!writer.Filled_ || !writer.Empty_ || writer.FreeCount_ != 2 * EBOXPY_DUMP_WORKERS)
+		goto cleanup_writer;
+	writer.Offset_ = EBOXPY_DUMP_ALIGNMENT;
+	unsigned long maximum = _EBoxPY_Parallel_Count();
+	for (unsigned long i = 0; i < EBOXPY_DUMP_WORKERS && i < maximum; ++i) {
+		workers[count] = CreateThread(NULL, 0, _EBoxPY_Dump_Worker, &writer, 0, NULL);
+		if (workers[count])
+			++count;
+	}
+	void* workspace = (!count && writer.Compress_ ? malloc(writer.WorkSpaceSize_ ? writer.WorkSpaceSize_ : 1) : NULL);
+	unsigned char* scratch = (!count && writer.Compress_ ? (unsigned char*)malloc(EBOXPY_DUMP_CHUNK) : NULL);
+	_PEBoxPY_Dump_Region _regions = (_PEBoxPY_Dump_Region)regions.Data_;
+	for (unsigned long long i = 0; i < regions.Count_ && !writer.Failed_; ++i) {
+		for (unsigned long long j = 0; j < _regions[i].ChunkCount_ && !writer.Failed_; ++j) {
+			_EBoxPY_Dump_Job job = {0};
+			unsigned long long offset = j * EBOXPY_DUMP_CHUNK;
+			job.Buffer_ = _EBoxPY_Dump_Writer_Buffer(&writer);
+			job.Size_ = (unsigned long)(_regions[i].Size_ - offset < EBOXPY_DUMP_CHUNK ? _regions[i].Size_ - offset : EBOXPY_DUMP_CHUNK);
+			job.Chunk_ = _regions[i].Chunk_ + j;
+			job.Valid_ = (char)(ReadProcessMemory(_Process, (void*)(_regions[i].Address_ + offset), job.Buffer_, job.Size_, NULL) != FALSE);
+			if (count) {
+				_EBoxPY_Dump_Writer_Push(&writer, &job);
+			}
+			else {
+				_EBoxPY_Dump_Store(&writer, &job, workspace, scratch);
+				writer.Free_[writer.FreeCount_++] = job.Buffer_;
+				ReleaseSemaphore(writer.Empty_, 1, NULL);
+			}
+		}
+	}
+	for (unsigned long i = 0; i < count; ++i) {
+		_EBoxPY_Dump_Job job = {0};
+		_EBoxPY_Dump_Writer_Push(&writer, &job);
+	}
+	if (count)
+		WaitForMultipleObjects(count, workers, TRUE, INFINITE);
+	for (unsigned long i = 0; i < count; ++i)
+		CloseHandle(workers[i]);
+	free(workspace);
+	free(scratch);
+	if (writer.Failed_)
+		goto cleanup_writer;
+	_EBoxPY_Dump_Header header;
+	memset(&header, 0, sizeof(_EBoxPY_Dump_Header));
+	header.Magic_ = EBOXPY_DUMP_MAGIC;
+	header.Version_ = EBOXPY_DUMP_VERSION;
+	header.Flags_ = (writer.Compress_ ? EBOXPY_DUMP_COMPRESSED : 0);
+	header.Architecture_ = _Architecture;
+	header.ID_ = (unsigned int)_ID;
+	header.ChunkSize_ = EBOXPY_DUMP_CHUNK;
+	if (_Name)
+		wcsncpy(header.Name_, _Name, MAX_PATH - 1);
+	unsigned long long offset = ((unsigned long long)writer.Offset_ + 0xF) & ~0xFULL;
+	header.RegionCount_ = regions.Count_;
+	header.RegionOffset_ = offset;
+	offset += ((regions.Count_ * sizeof(_EBoxPY_Dump_Region)) + 0xF) & ~0xFULL;
+	header.ChunkCount_ = chunks;
+	header.ChunkOffset_ = offset;
+	offset += ((chunks * sizeof(_EBoxPY_Dump_Chunk)) + 0xF) & ~0xFULL;
+	header.ModuleCount_ = modules.Count_;
+	header.ModuleOffset_ = offset;
+	offset += ((modules.Count_ * sizeof(_EBoxPY_Dump_Module)) + 0xF) & ~0xFULL;
+	header.ThreadCount_ = threads.Count_;
+	header.ThreadOffset_ = offset;
+	status = _EBoxPY_File_Write(writer.File_, header.RegionOffset_, regions.Data_, regions.Count_ * sizeof(_EBoxPY_Dump_Region))
+		&& _EBoxPY_File_Write(writer.File_, header.ChunkOffset_, writer.Chunks_, chunks * sizeof(_EBoxPY_Dump_Chunk))
+		&& _EBoxPY_File_Write(writer.File_, header.ModuleOffset_, modules.Data_, modules.Count_ * sizeof(_EBoxPY_Dump_Module))
+		&& _EBoxPY_File_Write(writer.File_, header.ThreadOffset_, threads.Data_, threads.Count_ * sizeof(_EBoxPY_Dump_Thread))
+		&& _EBoxPY_File_Write(writer.File_, 0, &header, sizeof(_EBoxPY_Dump_Header));
+cleanup_writer:
+	for (unsigned long i = 0; i < writer.FreeCount_; ++i)
+		free(writer.Free_[i]);
+	if (writer.Filled_)
+		CloseHandle(writer.Filled_);
+	if (writer.Empty_)
+		CloseHandle(writer.Empty_);
+	DeleteCriticalSection(&writer.Lock_);
+	CloseHandle(writer.File_);
+cleanup:
+	free(writer.Chunks_);
+	free(regions.Data_);
+	free(modules.Data_);
+	free(threads.Data_);
+	return status;
+}
+
+/*
+ * Reading: the file is mapped once, uncompressed Chunks are copied straight out of the view,
+ * compressed Chunks go through a small cache of decompressed Chunks.
+ */
+
+static void _EBoxPY_Dump_Close(_PEBoxPY_Dump _Dump) {
+	if (!_Dump)
+		return;
+	for (unsigned long i = 0; i < EBOXPY_DUMP_CACHE; ++i)
+		free(_Dump->Cache_[i]);
+	if (_Dump->View_)
+		UnmapViewOfFile(_Dump->View_);
+	if (_Dump->Mapping_)
+		CloseHandle(_Dump->Mapping_);
+	if (_Dump->File_ && _Dump->File_ != INVALID_HANDLE_VALUE)
+		CloseHandle(_Dump->File_);
+	free(_Dump);
+}
+
+static void* _EBoxPY_Dump_Table(_PEBoxPY_Dump _Dump, unsigned long long _Offset, unsigned long long _Count, unsigned long long _Stride) {
+	if (_Count && _Stride > (~0ULL) / _Count)
+		return NULL;
+	if (_Offset > _Dump->Size_ || _Count * _Stride > _Dump->Size_ - _Offset)
+		return NULL;
+	return _Dump->View_ + _Offset;
+}
+
+static _PEBoxPY_Dump _EBoxPY_Dump_Open(const wchar_t* _Path) {
+	_PEBoxPY_Dump dump = (_PEBoxPY_Dump)calloc(1, sizeof(_EBoxPY_Dump));
+	if (!dump)
+		return NULL;
+	InitializeSRWLock(&dump->Lock_);
+	dump->File_ = CreateFileW(_Path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (dump->File_ == INVALID_HANDLE_VALUE) {
+		dump->File_ = NULL;
+		_EBoxPY_Dump_Close(dump);
 		return NULL;
 	}
-	if (!PyBool_Check(_Suspended)) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.StartProcess Requires _Suspended to be bool.");
+	LARGE_INTEGER size = {0};
+	if (!GetFileSizeEx(dump->File_, &size) || size.QuadPart < (LONGLONG)sizeof(_EBoxPY_Dump_Header)) {
+		_EBoxPY_Dump_Close(dump);
 		return NULL;
 	}
-	int suspended = PyObject_IsTrue(_Suspended);
-	Py_ssize_t length = 0;
-	wchar_t* executable = PyUnicode_AsWideCharString(_Executable, &length);
-	if (!executable) {
+	dump->Size_ = (unsigned long long)size.QuadPart;
+	dump->Mapping_ = CreateFileMappingW(dump->File_, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (!dump->Mapping_) {
+		_EBoxPY_Dump_Close(dump);
 		return NULL;
 	}
-	STARTUPINFOW startup = {0};
-	startup.cb = sizeof(STARTUPINFOW);
-	PROCESS_INFORMATION information = {0};
-	if (!CreateProcessW(NULL, executable, NULL, NULL, FALSE, (suspended ? CREATE_SUSPENDED : 0), NULL, NULL, &startup, &information)) {
-		PyMem_Free(executable);
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.StartProcess Failed to Start Process.");
+	dump->View_ = (unsigned char*)MapViewOfFile(dump->Mapping_, FILE_MAP_READ, 0, 0, 0);
+	if (!dump->View_) {
+		_EBoxPY_Dump_Close(dump);
 		return NULL;
 	}
-	PyMem_Free(executable);
-	PyObject* thread = _EBoxPY_Create_Thread_Handle(information.hThread);
-	if (!thread){
-		CloseHandle(information.hProcess);
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.StartProcess Failed to Create Thread.");
+	dump->Header_ = (_PEBoxPY_Dump_Header)dump->View_;
+	if (dump->Header_->Magic_ != EBOXPY_DUMP_MAGIC || dump->Header_->Version_ != EBOXPY_DUMP_VERSION || !dump->Header_->ChunkSize_) {
+		_EBoxPY_Dump_Close(dump);
 		return NULL;
 	}
-	if (suspended) {
-		if (!EBoxPY_Thread_Lock((PEBoxPY_Thread)thread)) {
-			CloseHandle(information.hProcess);
-			Py_DECREF(thread);
-			return NULL;
-		}
-		ResumeThread(information.hThread); // Because EBoxPY_Thread_Lock suspends!
+	dump->Regions_ = (_PEBoxPY_Dump_Region)_EBoxPY_Dump_Table(dump, dump->Header_->RegionOffset_, dump->Header_->RegionCount_, sizeof(_EBoxPY_Dump_Region));
+	dump->Chunks_ = (_PEBoxPY_Dump_Chunk)_EBoxPY_Dump_Table(dump, dump->Header_->ChunkOffset_, dump->Header_->ChunkCount_, sizeof(_EBoxPY_Dump_Chunk));
+	dump->Modules_ = (_PEBoxPY_Dump_Module)_EBoxPY_Dump_Table(dump, dump->Header_->ModuleOffset_, dump->Header_->ModuleCount_, sizeof(_EBoxPY_Dump_Module));
+	dump->Threads_ = (_PEBoxPY_Dump_Thread)_EBoxPY_Dump_Table(dump, dump->Header_->ThreadOffset_, dump->Header_->ThreadCount_, sizeof(_EBoxPY_Dump_Thread));
+	if (!dump->Regions_ || !dump->Chunks_ || !dump->Modules_ || !dump->Threads_) {
+		_EBoxPY_Dump_Close(dump);
+		return NULL;
 	}
+	return dump;
+}
+
+static _PEBoxPY_Dump_Region _EBoxPY_Dump_Find(_PEBoxPY_Dump _Dump, unsigned long long _Address) {
+	unsigned long long low = 0;
+	unsigned long long high = _Dump->Header_->RegionCount_;
+	while (low < high) {
+		unsigned long long middle = low + (high - low) / 2;
+		_PEBoxPY_Dump_Region region = &_Dump->Regions_[middle];
+		if (_Address < region->Address_)
+			high = middle;
+		else if (_Address - region->Address_ >= region->Size_)
+			low = middle + 1;
+		else
+			return region;
+	}
+	return NULL;
+}
+
+static int _EBoxPY_Dump_Query(_PEBoxPY_Dump _Dump, unsigned long long _Address, MEMORY_BASIC_INFORMATION* _Information, char* _Backed) {
+	_PEBoxPY_Dump_Region region = _EBoxPY_Dump_Find(_Dump, _Address);
+	if (!region)
+		return 0;
+	memset(_Information, 0, sizeof(MEMORY_BASIC_INFORMATION));
+	_Information->AllocationBase = (void*)region->Allocation_;
+	_Information->BaseAddress = (void*)region->Address_;
+	_Information->RegionSize = (SIZE_T)region->Size_;
+	_Information->Protect = (DWORD)region->Protection_;
+	_Information->State = (DWORD)region->State_;
+	_Information->Type = (DWORD)region->Type_;
+	if (_Backed)
+		*_Backed = (char)(region->Backed_ ? 1 : 0);
+	return 1;
+}
+
+static int _EBoxPY_Dump_Chunk_Copy(_PEBoxPY_Dump _Dump, unsigned long long _Chunk, unsigned long long _Offset, unsigned long long _ChunkSize, void* _Buffer, unsigned long long _Size) {
+	_PEBoxPY_Dump_Chunk chunk = &_Dump->Chunks_[_Chunk];
+	if (!chunk->Size_ || chunk->Offset_ > _Dump->Size_ || chunk->Size_ > _Dump->Size_ - chunk->Offset_)
+		return 0;
+	if (!(chunk->Flags_ & EBOXPY_DUMP_COMPRESSED)) {
+		if (_Offset + _Size > chunk->Size_)
+			return 0;
+		memcpy(_Buffer, _Dump->View_ + chunk->Offset_ + _Offset, _Size);
+		return 1;
+	}
+	AcquireSRWLockExclusive(&_Dump->Lock_);
+	unsigned char* cache = NULL;
+	for (unsigned long i = 0; i < EBOXPY_DUMP_CACHE; ++i) {
+		if (_Dump->CacheChunk_[i] == _Chunk + 1)
+			cache = _Dump->Cache_[i];
+	}
+	if (!cache) {
+		unsigned long slot = _Dump->CacheNext_++ % EBOXPY_DUMP_CACHE;
+		if (!_Dump->Cache_[slot])
+			_Dump->Cache_[slot] = (unsigned char*)malloc(_Dump->Header_->ChunkSize_);
+		_EBoxPY_RtlDecompressBuffer decompress = (_EBoxPY_RtlDecompressBuffer)_EBoxPY_Ntdll("RtlDecompressBuffer");
+		unsigned long size = 0;
+		_Dump->CacheChunk_[slot] = 0;
+		if (!_Dump->Cache_[slot] || !decompress || decompress(EBOXPY_COMPRESSION_FORMAT, _Dump->Cache_[slot], _Dump->Header_->ChunkSize_, _Dump->View_ + chunk->Offset_, chunk->Size_, &size) < 0 || size < _ChunkSize) {
+			ReleaseSRWLockExclusive(&_Dump->Lock_);
+			return 0;
+		}
+		_Dump->CacheChunk_[slot] = _Chunk + 1;
+		cache = _Dump->Cache_[slot];
+	}
+	memcpy(_Buffer, cache + _Offset, _Size);
+	ReleaseSRWLockExclusive(&_Dump->Lock_);
+	return 1;
+}
+
+static int _EBoxPY_Dump_Read(_PEBoxPY_Dump _Dump, unsigned long long _Address, void* _Buffer, unsigned long long _Size) {
+	unsigned long long chunk_size = _Dump->Header_->ChunkSize_;
+	while (_Size) {
+		_PEBoxPY_Dump_Region region = _EBoxPY_Dump_Find(_Dump, _Address);
+		if (!region || !region->ChunkCount_)
+			return 0;
+		unsigned long long offset = _Address - region->Address_;
+		unsigned long long index = offset / chunk_size;
+		if (index >= region->ChunkCount_ || region->Chunk_ + index >= _Dump->Header_->ChunkCount_)
+			return 0;
+		unsigned long long within = offset % chunk_size;
+		unsigned long long length = region->Size_ - index * chunk_size;
+		if (length > chunk_size)
+			length = chunk_size;
+		unsigned long long size = (length - within < _Size ? length - within : _Size);
+		if (!_EBoxPY_Dump_Chunk_Copy(_Dump, region->Chunk_ + index, within, length, _Buffer, size))
+			return 0;
+		_Address += size;
+		_Buffer = (char*)_Buffer + size;
+		_Size -= size;
+	}
+	return 1;
+}
+
+/*
+ *
+ * EBoxPY System
+ *
+ */
+
+#define EBOXPY_SYSTEM_PROCESS_INFORMATION 5
+#define EBOXPY_STATUS_INFO_LENGTH_MISMATCH ((long)0xC0000004)
+
+typedef long (WINAPI* _EBoxPY_NtQuerySystemInformation)(unsigned long, void*, unsigned long, unsigned long*);
+
+typedef struct _EBoxPY_System_Thread_T {
+	long long KernelTime_;
+	long long UserTime_;
+	long long CreateTime_;
+	unsigned long WaitTime_;
+	void* StartAddress_;
+	HANDLE UniqueProcess_;
+	HANDLE UniqueThread_;
+	long Priority_;
+	long BasePriority_;
+	unsigned long ContextSwitches_;
+	unsigned long ThreadState_;
+	unsigned long WaitReason_;
+} _EBoxPY_System_Thread, *_PEBoxPY_System_Thread;
+
+// SYSTEM_PROCESS_INFORMATION, spelled out in full since winternl.h hides most of it.
+typedef struct _EBoxPY_System_Process_T {
+	unsigned long NextEntryOffset_;
+	unsigned long NumberOfThreads_;
+	long long WorkingSetPrivateSize_;
+	unsigned long HardFaultCount_;
+	unsigned long NumberOfThreadsHighWatermark_;
+	unsigned long long CycleTime_;
+	long long CreateTime_;
+	long long UserTime_;
+	long long KernelTime_;
+	unsigned short NameLength_;
+	unsigned short NameMaximumLength_;
+	wchar_t* Name_;
+	long BasePriority_;
+	HANDLE UniqueProcessId_;
+	HANDLE InheritedFromUniqueProcessId_;
+	unsigned long HandleCount_;
+	unsigned long SessionId_;
+	ULONG_PTR UniqueProcessKey_;
+	SIZE_T PeakVirtualSize_;
+	SIZE_T VirtualSize_;
+	unsigned long PageFaultCount_;
+	SIZE_T PeakWorkingSetSize_;
+	SIZE_T WorkingSetSize_;
+	SIZE_T QuotaPeakPagedPoolUsage_;
+	SIZE_T QuotaPagedPoolUsage_;
+	SIZE_T QuotaPeakNonPagedPoolUsage_;
+	SIZE_T QuotaNonPagedPoolUsage_;
+	SIZE_T PagefileUsage_;
+	SIZE_T PeakPagefileUsage_;
+	SIZE_T PrivatePageCount_;
+	long long ReadOperationCount_;
+	long long WriteOperationCount_;
+	long long OtherOperationCount_;
+	long long ReadTransferCount_;
+	long long WriteTransferCount_;
+	long long OtherTransferCount_;
+	_EBoxPY_System_Thread Threads_[1];
+} _EBoxPY_System_Process, *_PEBoxPY_System_Process;
+
+static volatile LONG _EBoxPY_System_Size = 0x40000;
+
+// One NtQuerySystemInformation pass over every Process and Thread, free() the result, safe to call without the GIL.
+static _PEBoxPY_System_Process _EBoxPY_System_Query(void) {
+	static _EBoxPY_NtQuerySystemInformation query = NULL;
+	if (!query)
+		query = (_EBoxPY_NtQuerySystemInformation)_EBoxPY_Ntdll("NtQuerySystemInformation");
+	if (!query)
+		return NULL;
+	unsigned long size = (unsigned long)_EBoxPY_System_Size;
+	for (;;) {
+		void* buffer = malloc(size);
+		if (!buffer)
+			return NULL;
+		unsigned long needed = 0;
+		long status = query(EBOXPY_SYSTEM_PROCESS_INFORMATION, buffer, size, &needed);
+		if (status >= 0) {
+			InterlockedExchange(&_EBoxPY_System_Size, (LONG)size);
+			return (_PEBoxPY_System_Process)buffer;
+		}
+		free(buffer);
+		if (status != EBOXPY_STATUS_INFO_LENGTH_MISMATCH)
+			return NULL;
+		// Leave room for whatever starts between the two calls.
+		size = (needed > size ? needed : size) + size / 4;
+	}
+}
+
+static _PEBoxPY_System_Process _EBoxPY_System_Next(_PEBoxPY_System_Process _Process) {
+	if (!_Process->NextEntryOffset_)
+		return NULL;
+	return (_PEBoxPY_System_Process)((unsigned char*)_Process + _Process->NextEntryOffset_);
+}
+
+typedef struct _EBoxPY_Thread_Record_T {
+	unsigned long ID_;
+	long long CreateTime_;
+} _EBoxPY_Thread_Record, *_PEBoxPY_Thread_Record;
+
+static int _EBoxPY_Thread_Record_Compare(const void* _Left, const void* _Right) {
+	unsigned long left = ((const _EBoxPY_Thread_Record*)_Left)->ID_;
+	unsigned long right = ((const _EBoxPY_Thread_Record*)_Right)->ID_;
+	return (left > right) - (left < right);
+}
+
+// Copies out the Threads of a single Process sorted by ID_, a Process that has exited simply has none.
+static int _EBoxPY_System_Threads(unsigned long _Process, _PEBoxPY_Thread_Record* _Records, unsigned long long* _Count) {
+	*_Records = NULL;
+	*_Count = 0;
+	_PEBoxPY_System_Process buffer = _EBoxPY_System_Query();
+	if (!buffer)
+		return 0;
+	_PEBoxPY_System_Process process = buffer;
+	while (process && (unsigned long)(ULONG_PTR)process->UniqueProcessId_ != _Process)
+		process = _EBoxPY_System_Next(process);
+	unsigned long long count = (process ? process->NumberOfThreads_ : 0);
+	*_Records = (_PEBoxPY_Thread_Record)malloc(((size_t)count + 1) * sizeof(_EBoxPY_Thread_Record));
+	if (!*_Records) {
+		free(buffer);
+		return 0;
+	}
+	for (unsigned long long i = 0; i < count; ++i) {
+		(*_Records)[i].ID_ = (unsigned long)(ULONG_PTR)process->Threads_[i].UniqueThread_;
+		(*_Records)[i].CreateTime_ = process->Threads_[i].CreateTime_;
+	}
+	free(buffer);
+	qsort(*_Records, (size_t)count, sizeof(_EBoxPY_Thread_Record), _EBoxPY_Thread_Record_Compare);
+	*_Count = count;
+	return 1;
+}
+
+static int _EBoxPY_Append_ID(PyObject* _List, unsigned long _ID) {
+	PyObject* id = PyLong_FromUnsignedLong(_ID);
+	if (!id)
+		return 0;
+	int status = PyList_Append(_List, id);
+	Py_DECREF(id);
+	return status == 0;
+}
+
+// Diffs two ID_ sorted record arrays, an ID_ is only the same Thread or Process if its CreateTime_ matches too.
+static int _EBoxPY_Diff_Records(_PEBoxPY_Thread_Record _Old, unsigned long long _OldCount, _PEBoxPY_Thread_Record _Records, unsigned long long _Count, PyObject* _New, PyObject* _Exited) {
+	unsigned long long i = 0;
+	unsigned long long j = 0;
+	while (i < _OldCount || j < _Count) {
+		if (j == _Count || (i < _OldCount && _Old[i].ID_ < _Records[j].ID_)) {
+			if (!_EBoxPY_Append_ID(_Exited, _Old[i++].ID_))
+				return 0;
+		}
+		else if (i == _OldCount || _Records[j].ID_ < _Old[i].ID_) {
+			if (!_EBoxPY_Append_ID(_New, _Records[j++].ID_))
+				return 0;
+		}
+		else {
+			if (_Old[i].CreateTime_ != _Records[j].CreateTime_ && (!_EBoxPY_Append_ID(_Exited, _Old[i].ID_) || !_EBoxPY_Append_ID(_New, _Records[j].ID_)))
+				return 0;
+			++i;
+			++j;
+		}
+	}
+	return 1;
+}
+
+typedef struct _EBoxPY_Module_Range_T {
+	unsigned long long Address_;
+	unsigned long long Size_;
+	wchar_t Name_[MAX_MODULE_NAME32 + 1];
+} _EBoxPY_Module_Range, *_PEBoxPY_Module_Range;
+
+static int _EBoxPY_Module_Range_Compare(const void* _Left, const void* _Right) {
+	unsigned long long left = ((const _EBoxPY_Module_Range*)_Left)->Address_;
+	unsigned long long right = ((const _EBoxPY_Module_Range*)_Right)->Address_;
+	return (left > right) - (left < right);
+}
+
+// Copies out the Modules of a single Process sorted by Address_, safe to call without the GIL.
+static int _EBoxPY_System_Modules(unsigned long _Process, _PEBoxPY_Module_Range* _Ranges, unsigned long long* _Count) {
+	*_Ranges = NULL;
+	*_Count = 0;
+	HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPMODULE | TH32CS_SNAPMODULE32, (DWORD)_Process);
+	if (!snapshot || snapshot == INVALID_HANDLE_VALUE)
+		return 0;
+	unsigned long long capacity = 0;
+	MODULEENTRY32W entry = {0};
+	entry.dwSize = sizeof(MODULEENTRY32W);
+	for (BOOL b = Module32FirstW(snapshot, &entry); b == TRUE; b = Module32NextW(snapshot, &entry)) {
+		if (*_Count == capacity) {
+			capacity = (capacity ? capacity * 2 : 64);
+			_PEBoxPY_Module_Range ranges = (_PEBoxPY_Module_Range)realloc(*_Ranges, (size_t)capacity * sizeof(_EBoxPY_Module_Range));
+			if (!ranges)
+				break;
+			*_Ranges = ranges;
+		}
+		_PEBoxPY_Module_Range range = &(*_Ranges)[(*_Count)++];
+		range->Address_ = (unsigned long long)entry.modBaseAddr;
+		range->Size_ = (unsigned long long)entry.modBaseSize;
+		memcpy(range->Name_, entry.szModule, sizeof(range->Name_));
+	}
+	CloseHandle(snapshot);
+	qsort(*_Ranges, (size_t)*_Count, sizeof(_EBoxPY_Module_Range), _EBoxPY_Module_Range_Compare);
+	return 1;
+}
+
+static _PEBoxPY_Module_Range _EBoxPY_Find_Module_Range(_PEBoxPY_Module_Range _Ranges, unsigned long long _Count, unsigned long long _Address) {
+	unsigned long long low = 0;
+	unsigned long long high = _Count;
+	while (low < high) {
+		unsigned long long middle = low + (high - low) / 2;
+		if (_Ranges[middle].Address_ <= _Address)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	if (low && _Address - _Ranges[low - 1].Address_ < _Ranges[low - 1].Size_)
+		return &_Ranges[low - 1];
+	return NULL;
+}
+
+/*
+ *
+ * EBoxPY Self
+ *
+ */
+
+#define EBOXPY_SELF_READABLE (EBOXPY_REGION_READABLE | PAGE_WRITECOPY | PAGE_EXECUTE_WRITECOPY)
+#define EBOXPY_SELF_WRITABLE (PAGE_READWRITE | PAGE_EXECUTE_READWRITE)
+
+// The committed Regions of the current Process seen so far, Reads and Writes inside them are plain copies instead of system calls.
+typedef struct _EBoxPY_Self_T {
+	SRWLOCK Lock_;
+	_EBoxPY_Ranges Readable_;
+	_EBoxPY_Ranges Writable_;
+} _EBoxPY_Self, *_PEBoxPY_Self;
+
+static void _EBoxPY_Self_Destroy(_PEBoxPY_Self _Self) {
+	if (!_Self)
+		return;
+	_EBoxPY_Ranges_Free(&_Self->Readable_);
+	_EBoxPY_Ranges_Free(&_Self->Writable_);
+	free(_Self);
+}
+
+static _PEBoxPY_Self _EBoxPY_Self_Create(void) {
+	_PEBoxPY_Self self = (_PEBoxPY_Self)calloc(1, sizeof(_EBoxPY_Self));
+	if (self)
+		InitializeSRWLock(&self->Lock_);
+	return self;
+}
+
+// Replaces [_Start, _End) in _Ranges, keeping it sorted, the Range is put back only when _Include is set.
+static void _EBoxPY_Self_Splice(_PEBoxPY_Ranges _Ranges, unsigned long long _Start, unsigned long long _End, int _Include) {
+	_EBoxPY_Ranges output = {0};
+	int inserted = !_Include;
+	for (unsigned long long i = 0; i < _Ranges->Count_; ++i) {
+		unsigned long long start = _Ranges->Data_[2 * i];
+		unsigned long long end = _Ranges->Data_[2 * i + 1];
+		if (start < _Start)
+			_EBoxPY_Ranges_Add(&output, start, (end < _Start ? end : _Start));
+		if (end > _End) {
+			if (!inserted) {
+				_EBoxPY_Ranges_Add(&output, _Start, _End);
+				inserted = 1;
+			}
+			_EBoxPY_Ranges_Add(&output, (start > _End ? start : _End), end);
+		}
+	}
+	if (!inserted)
+		_EBoxPY_Ranges_Add(&output, _Start, _End);
+	// A partial map would only send more copies down the system call path.
+	if (output.Failed_)
+		_EBoxPY_Ranges_Free(&output);
+	_EBoxPY_Ranges_Free(_Ranges);
+	*_Ranges = output;
+}
+
+// Queries only the Regions under _Address to _Address + _Size and patches them into both maps, PAGE_GUARD pages are left out so a copy never consumes a guard.
+static void _EBoxPY_Self_Patch(_PEBoxPY_Self _Self, unsigned long long _Address, unsigned long long _Size) {
+	unsigned long long end = (_Address + _Size < _Address ? ~0ull : _Address + _Size);
+	unsigned long long address = _Address;
+	MEMORY_BASIC_INFORMATION information = {0};
+	do {
+		if (VirtualQuery((LPCVOID)address, &information, sizeof(MEMORY_BASIC_INFORMATION)) == 0 || !information.RegionSize)
+			break;
+		unsigned long long start = (unsigned long long)information.BaseAddress;
+		unsigned long long stop = start + information.RegionSize;
+		int committed = (information.State == MEM_COMMIT && !(information.Protect & PAGE_GUARD));
+		AcquireSRWLockExclusive(&_Self->Lock_);
+		_EBoxPY_Self_Splice(&_Self->Readable_, start, stop, committed && (information.Protect & EBOXPY_SELF_READABLE));
+		_EBoxPY_Self_Splice(&_Self->Writable_, start, stop, committed && (information.Protect & EBOXPY_SELF_WRITABLE));
+		ReleaseSRWLockExclusive(&_Self->Lock_);
+		address = stop;
+	} while (address && address < end);
+}
+
+static int _EBoxPY_Self_Covered(_PEBoxPY_Self _Self, _PEBoxPY_Ranges _Ranges, unsigned long long _Address, unsigned long long _Size) {
+	AcquireSRWLockShared(&_Self->Lock_);
+	unsigned long long low = 0;
+	unsigned long long high = _Ranges->Count_;
+	while (low < high) {
+		unsigned long long middle = low + (high - low) / 2;
+		if (_Ranges->Data_[2 * middle + 1] <= _Address)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	int covered = (low < _Ranges->Count_ && _Ranges->Data_[2 * low] <= _Address && _Size <= _Ranges->Data_[2 * low + 1] - _Address);
+	ReleaseSRWLockShared(&_Self->Lock_);
+	return covered;
+}
+
+static int _EBoxPY_Self_Filter(unsigned long _Code) {
+	if (_Code == EXCEPTION_ACCESS_VIOLATION || _Code == EXCEPTION_IN_PAGE_ERROR || _Code == EXCEPTION_GUARD_PAGE)
+		return EXCEPTION_EXECUTE_HANDLER;
+	return EXCEPTION_CONTINUE_SEARCH;
+}
+
+// The map can be stale by the time the copy runs, a Region freed in between faults here instead of crashing.
+static int _EBoxPY_Self_Copy(void* _Destination, const void* _Source, unsigned long long _Size) {
+	__try {
+		memcpy(_Destination, _Source, (size_t)_Size);
+	}
+	__except (_EBoxPY_Self_Filter(GetExceptionCode())) {
+		return 0;
+	}
+	return 1;
+}
+
+// Returns -1 when the range is not mapped even after a patch or the copy faulted, the caller then falls back to the system call.
+static int _EBoxPY_Self_Transfer(_PEBoxPY_Self _Self, int _Write, unsigned long long _Address, void* _Buffer, unsigned long long _Size) {
+	_PEBoxPY_Ranges ranges = (_Write ? &_Self->Writable_ : &_Self->Readable_);
+	if (!_EBoxPY_Self_Covered(_Self, ranges, _Address, _Size)) {
+		_EBoxPY_Self_Patch(_Self, _Address, _Size);
+		if (!_EBoxPY_Self_Covered(_Self, ranges, _Address, _Size))
+			return -1;
+	}
+	if (_Write ? _EBoxPY_Self_Copy((void*)_Address, _Buffer, _Size) : _EBoxPY_Self_Copy(_Buffer, (const void*)_Address, _Size))
+		return 1;
+	// A protection changed since the patch, e.g. by a PatchSet, the system call reports the current state.
+	_EBoxPY_Self_Patch(_Self, _Address, _Size);
+	return -1;
+}
+
+/*
+ *
+ * EBoxPY.Process
+ *
+ */
+
+PyDoc_STRVAR(EBoxPY_Process__doc__, "EBoxPY Process object, defines a running Process.");
+
+typedef struct EBoxPY_Process_T {
+	//
+	PyObject_HEAD
+	//
+	HANDLE Process_;
+	char IsOpen_;
+	unsigned long ID_;
+	//
+	PyObject* Name_;
+	//
+	char IsDump_;
+	_PEBoxPY_Dump Dump_;
+	//
+	char IsSelf_;
+	_PEBoxPY_Self Self_;
+	//
+	SRWLOCK BounceLock_;
+	unsigned char* Bounce_;
+	//
+	volatile LONG Pending_;
+	//
+	struct _EBoxPY_Freezer_T* Freezer_;
+	struct _EBoxPY_Unwind_T* Unwind_;
+	//
+	_PEBoxPY_Thread_Record Threads_;
+	unsigned long long ThreadCount_;
+	//
+	SRWLOCK BreakpointLock_;
+	_EBoxPY_Breakpoint Breakpoints_[4];
+	//
+} EBoxPY_Process, *PEBoxPY_Process;
+
+static void _EBoxPY_Freezer_Destroy(struct _EBoxPY_Freezer_T* _Freezer);
+static void _EBoxPY_Unwind_Destroy(struct _EBoxPY_Unwind_T* _Unwind);
+
+static void EBoxPY_Process_dealloc(PyObject* self);
+static PyObject* EBoxPY_Process_repr(PyObject* self);
+
+static PyObject* EBoxPY_Process_Open(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_Close(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_GetModules(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_GetRegion(PEBoxPY_Process self, PyObject* address);
+static PyObject* EBoxPY_Process_ReadTo(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_WriteFrom(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_View(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_Copy(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_Fill(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_Compare(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_GetThreads(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_RefreshThreads(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_Suspend(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_Resume(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_CaptureState(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_SetBreakpointAll(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_RemoveBreakpointAll(PEBoxPY_Process self, PyObject* index);
+static PyObject* EBoxPY_Process_Allocate(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_Free(PEBoxPY_Process self, PyObject* allocation);
+static PyObject* EBoxPY_Process_IsI386(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_IsAMD64(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_Dump(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_Snapshot(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_GetRegions(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_ReadToAsync(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_WriteFromAsync(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_GetModulesAsync(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_GetThreadsAsync(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_GetRegionsAsync(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_Watch(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_Freeze(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_Unfreeze(PEBoxPY_Process self, PyObject* handle);
+static PyObject* EBoxPY_Process_GetFrozen(PEBoxPY_Process self);
+static PyObject* EBoxPY_Process_CreateArena(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_Debug(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_Profile(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_Traverse(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_FindPointerPaths(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_OpenStream(PEBoxPY_Process self, PyObject* args);
+static PyObject* EBoxPY_Process_PatchSet(PEBoxPY_Process self);
+
+static PyMemberDef EBoxPY_Process_Members[] = {
+	{"Process_", T_ULONGLONG, offsetof(EBoxPY_Process, Process_), READONLY, PyDoc_STR("The Handle to the Process.")},
+	{"IsOpen_", T_BOOL, offsetof(EBoxPY_Process, IsOpen_), READONLY, PyDoc_STR("True if the Process is Open, False if not, defines validity of the Process Handle.")},
+	{"ID_", T_ULONG, offsetof(EBoxPY_Process, ID_), READONLY, PyDoc_STR("The ID of the Process.")},
+	{"Name_", T_OBJECT, offsetof(EBoxPY_Process, Name_), READONLY, PyDoc_STR("The Name of the Process, *.exe etc.")},
+	{"IsDump_", T_BOOL, offsetof(EBoxPY_Process, IsDump_), READONLY, PyDoc_STR("True if the Process is backed by a Dump file rather than a running Process.")},
+	{"IsSelf_", T_BOOL, offsetof(EBoxPY_Process, IsSelf_), READONLY, PyDoc_STR("True if the Process is the current Process, Reads and Writes to committed Regions are then direct copies.")},
+	{NULL}
+};
+
+static PyMethodDef EBoxPY_Process_Methods[] = {
+	{"Open", (PyCFunction)EBoxPY_Process_Open, METH_NOARGS, PyDoc_STR("EBoxPY.Process.Open()\nOpens the Process if it is not already open.")},
+	{"Close", (PyCFunction)EBoxPY_Process_Close, METH_NOARGS, PyDoc_STR("EBoxPY.Process.Close()\nCloses the Process, Closes the Handle.")},
+	{"GetModules", (PyCFunction)EBoxPY_Process_GetModules, METH_NOARGS, PyDoc_STR("EBoxPY.Process.GetModules() -> { \"*.dll\" : EBoxPY.Module(...), ... }\nRetrieves a dictionary of Modules currently loaded in the Process.")},
+	{"GetRegion", (PyCFunction)EBoxPY_Process_GetRegion, METH_O, PyDoc_STR("EBoxPY.Process.GetRegion(_Address) -> EBoxPY.Region\nGets the Region at the specified Address.")},
+	{"GetRegions", (PyCFunction)EBoxPY_Process_GetRegions, METH_NOARGS, PyDoc_STR("EBoxPY.Process.GetRegions() -> [ EBoxPY.Region(...), ... ]\nRetrieves a list of every Region in the Process, in Address order.")},
+	{"ReadTo", (PyCFunction)EBoxPY_Process_ReadTo, METH_VARARGS, PyDoc_STR("EBoxPY.Process.ReadTo(_Address, _Bytes, _Start, _Size)\nReads Bytes from Address into specified Bytes object.")},
+	{"WriteFrom", (PyCFunction)EBoxPY_Process_WriteFrom, METH_VARARGS, PyDoc_STR("EBoxPY.Process.WriteFrom(_Address, _Bytes, _Start, _Size)\nWrites Bytes to specified Address.")},
+	{"Copy", (PyCFunction)EBoxPY_Process_Copy, METH_VARARGS, PyDoc_STR("EBoxPY.Process.Copy(_Destination, _Source, _Size)\nCopies _Size bytes inside the Process natively in large chunks, overlapping ranges are handled like memmove.")},
+	{"Fill", (PyCFunction)EBoxPY_Process_Fill, METH_VARARGS, PyDoc_STR("EBoxPY.Process.Fill(_Address, _Byte, _Size)\nWrites _Size copies of _Byte at _Address natively in large chunks.")},
+	{"Compare", (PyCFunction)EBoxPY_Process_Compare, METH_VARARGS, PyDoc_STR("EBoxPY.Process.Compare(_Address, _Bytes) -> int\nCompares the memory at _Address with _Bytes, bytes-like or EBoxPY.Bytes, chunk by chunk, returns the offset of the first difference or -1 if they are equal.")},
+	{"PatchSet", (PyCFunction)EBoxPY_Process_PatchSet, METH_NOARGS, PyDoc_STR("EBoxPY.Process.PatchSet() -> EBoxPY.PatchSet\nCreates an empty PatchSet, patches Added to it are Applied and Reverted atomically, see EBoxPY.PatchSet.")},
+	{"OpenStream", (PyCFunction)EBoxPY_Process_OpenStream, METH_VARARGS, PyDoc_STR("EBoxPY.Process.OpenStream(_Address, _Size) -> EBoxPY.Stream\nReturns a seekable read-only file object over _Size bytes at _Address with adaptive native read-ahead, see EBoxPY.Stream.")},
+	{"View", (PyCFunction)EBoxPY_Process_View, METH_VARARGS, PyDoc_STR("EBoxPY.Process.View(_Address, _Size) -> EBoxPY.Bytes\nReturns Bytes over the live memory at _Address without a copy, only for the current Process, see IsSelf_.\nEvery access goes through a faulting copy, a View of memory that was freed or is not writable raises instead of crashing.")},
+	{"GetThreads", (PyCFunction)EBoxPY_Process_GetThreads, METH_NOARGS, PyDoc_STR("EBoxPY.Process.GetThreads() -> [ EBoxPY.Thread(...), ... ]\nRetrieves a list of Threads running in the Process.")},
+	{"Suspend", (PyCFunction)EBoxPY_Process_Suspend, METH_NOARGS, PyDoc_STR("EBoxPY.Process.Suspend()\nSuspends every Thread in the Process with a single call.")},
+	{"Resume", (PyCFunction)EBoxPY_Process_Resume, METH_NOARGS, PyDoc_STR("EBoxPY.Process.Resume()\nResumes every Thread in the Process with a single call.")},
+	{"CaptureState", (PyCFunction)EBoxPY_Process_CaptureState, METH_VARARGS, PyDoc_STR("EBoxPY.Process.CaptureState(_Ranges=None) -> ([ EBoxPY.Thread(...), ... ], [ EBoxPY.Bytes | None, ... ])\nSuspends the Process, Reads every Thread Context and each (Address, Size) in _Ranges, then Resumes it, all in one native pass.")},
+	{"SetBreakpointAll", (PyCFunction)EBoxPY_Process_SetBreakpointAll, METH_VARARGS, PyDoc_STR("EBoxPY.Process.SetBreakpointAll(_Index, _Address, _Condition, _Length=1) -> int\nInserts a Hardware Breakpoint into every Thread in one native pass, returns the number of Threads updated.\nThreads created later inherit it while an EBoxPY.Debugger is attached.")},
+	{"RemoveBreakpointAll", (PyCFunction)EBoxPY_Process_RemoveBreakpointAll, METH_O, PyDoc_STR("EBoxPY.Process.RemoveBreakpointAll(_Index) -> int\nRemoves the Hardware Breakpoint at _Index from every Thread, returns the number of Threads updated.")},
+	{"RefreshThreads", (PyCFunction)EBoxPY_Process_RefreshThreads, METH_NOARGS, PyDoc_STR("EBoxPY.Process.RefreshThreads() -> ([ ID, ... ], [ ID, ... ])\nReturns the IDs of the Threads started and exited since the last RefreshThreads, GetThreads does not affect it.")},
+	{"Allocate", (PyCFunction)EBoxPY_Process_Allocate, METH_VARARGS, PyDoc_STR("EBoxPY.Process.Allocate(_Size, _Address=None, _Range=None) -> int\nAllocates Memory in the Process with a given Size + Location options.")},
+	{"Free", (PyCFunction)EBoxPY_Process_Free, METH_O, PyDoc_STR("EBoxPY.Process.Free(_Allocation)\nFrees Memory in a Process.")},
+	{"IsI386", (PyCFunction)EBoxPY_Process_IsI386, METH_NOARGS, PyDoc_STR("EBoxPY.Process.IsI386() -> bool\nTrue if the Process is 32 bit, False otherwise.")},
+	{"IsAMD64", (PyCFunction)EBoxPY_Process_IsAMD64, METH_NOARGS, PyDoc_STR("EBoxPY.Process.IsAMD64() -> bool\nTrue if the Process is 64 bit, False otherwise.")},
+	{"Dump", (PyCFunction)EBoxPY_Process_Dump, METH_VARARGS, PyDoc_STR("EBoxPY.Process.Dump(_Path, _Compress=False)\nWrites every readable Region, the Modules and the Thread Contexts of the Process to a Dump file, see EBoxPY.OpenDump.")},
+	{"ReadToAsync", (PyCFunction)EBoxPY_Process_ReadToAsync, METH_VARARGS, PyDoc_STR("EBoxPY.Process.ReadToAsync(_Address, _Bytes, _Start, _Size) -> asyncio.Future\nAwaitable ReadTo, serviced by the native thread pool.")},
+	{"WriteFromAsync", (PyCFunction)EBoxPY_Process_WriteFromAsync, METH_VARARGS, PyDoc_STR("EBoxPY.Process.WriteFromAsync(_Address, _Bytes, _Start, _Size) -> asyncio.Future\nAwaitable WriteFrom, serviced by the native thread pool.")},
+	{"GetModulesAsync", (PyCFunction)EBoxPY_Process_GetModulesAsync, METH_NOARGS, PyDoc_STR("EBoxPY.Process.GetModulesAsync() -> asyncio.Future\nAwaitable GetModules, serviced by the native thread pool.")},
+	{"GetThreadsAsync", (PyCFunction)EBoxPY_Process_GetThreadsAsync, METH_NOARGS, PyDoc_STR("EBoxPY.Process.GetThreadsAsync() -> asyncio.Future\nAwaitable GetThreads, serviced by the native thread pool.")},
+	{"GetRegionsAsync", (PyCFunction)EBoxPY_Process_GetRegionsAsync, METH_NOARGS, PyDoc_STR("EBoxPY.Process.GetRegionsAsync() -> asyncio.Future\nAwaitable GetRegions, serviced by the native thread pool.")},
+	{"Snapshot", (PyCFunction)EBoxPY_Process_Snapshot, METH_NOARGS, PyDoc_STR("EBoxPY.Process.Snapshot() -> EBoxPY.Snapshot\nCopies every readable Region of the Process into a Snapshot.")},
+	{"Debug", (PyCFunction)EBoxPY_Process_Debug, METH_VARARGS, PyDoc_STR("EBoxPY.Process.Debug(_Registers=(\"RIP\",)) -> EBoxPY.Debugger\nAttaches a native debug loop that records every Hardware Breakpoint hit with the named Registers and continues automatically.")},
+	{"Traverse", (PyCFunction)EBoxPY_Process_Traverse, METH_VARARGS, PyDoc_STR("EBoxPY.Process.Traverse(_Start, _Spec) -> (bytes, [ bytes, ... ])\nWalks the linked structure at _Start described by an EBoxPY.Spec natively, level by level, visiting each node once.\nReturns the packed UINT64 node Addresses and one packed column per Spec field, see EBoxPY.Spec.Formats_.")},
+	{"FindPointerPaths", (PyCFunction)EBoxPY_Process_FindPointerPaths, METH_VARARGS, PyDoc_STR("EBoxPY.Process.FindPointerPaths(_Target, _Depth, _Offset, _Path, _Maximum=1000000) -> int\nBuilds a sorted map of every pointer in the readable Regions in parallel, then searches it backward from _Target for chains of at most _Depth pointers, each at most _Offset below the address it leads to, that start inside a Module.\nWrites one path per line to _Path as Module+Offset,Offset,... in dereference order and returns the number of paths written, at most _Maximum.")},
+	{"Profile", (PyCFunction)EBoxPY_Process_Profile, METH_VARARGS, PyDoc_STR("EBoxPY.Process.Profile(_Duration, _Hz=1000, _Stacks=False) -> ({ (Module, Offset) : Samples, ... }, str)\nSamples the RIP of every Thread at _Hz for _Duration seconds on a native loop, returns a histogram keyed by Module name and offset and the samples as folded stacks.\n_Stacks walks the RBP chain, so only frames of code built with frame pointers are seen, addresses outside any Module are keyed by (None, Address).")},
+	{"CreateArena", (PyCFunction)EBoxPY_Process_CreateArena, METH_VARARGS, PyDoc_STR("EBoxPY.Process.CreateArena(_Size, _Protection=PAGE_EXECUTE_READWRITE) -> EBoxPY.Arena\nAllocates _Size bytes in the Process once, then sub-allocates from it locally without further system calls.")},
+	{"Freeze", (PyCFunction)EBoxPY_Process_Freeze, METH_VARARGS, PyDoc_STR("EBoxPY.Process.Freeze(_Address, _Type, _Value, _Interval=1000) -> int\nRewrites the Native _Value at _Address every _Interval microseconds from a native Thread, returns a handle for Unfreeze.\n_Interval must be at least 500, the finest timer resolution.")},
+	{"Unfreeze", (PyCFunction)EBoxPY_Process_Unfreeze, METH_O, PyDoc_STR("EBoxPY.Process.Unfreeze(_Handle)\nStops rewriting a value started with Freeze.")},
+	{"GetFrozen", (PyCFunction)EBoxPY_Process_GetFrozen, METH_NOARGS, PyDoc_STR("EBoxPY.Process.GetFrozen() -> [ (Handle, Address, Writes, Failures, LastError), ... ]\nRetrieves the frozen values and their per-entry Write statistics.")},
+	{"Watch", (PyCFunction)EBoxPY_Process_Watch, METH_VARARGS, PyDoc_STR("EBoxPY.Process.Watch(_Locations, _Types, _Hz) -> EBoxPY.Watch\nSamples each location, an Address or a pointer path (Base, Offset, ...), at _Hz on a native Thread into a record buffer.")},
+	{NULL}
+};
+
+static PyTypeObject EBoxPY_Process_Type = {
+	PyObject_HEAD_INIT(NULL)
+	.tp_name = "EBoxPY.Process",
+	.tp_basicsize = sizeof(EBoxPY_Process),
+	.tp_doc = EBoxPY_Process__doc__,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_members = EBoxPY_Process_Members,
+	.tp_dealloc = EBoxPY_Process_dealloc,
+	.tp_repr = EBoxPY_Process_repr,
+	.tp_str = EBoxPY_Process_repr,
+	.tp_methods = EBoxPY_Process_Methods,
+};
+
+static int _EBoxPY_Initialize_Process(PyObject* self) {
+	if (PyType_Ready(&EBoxPY_Process_Type) < 0)
+		return 0;
+	PyModule_AddObject(self, "Process", (PyObject*)&EBoxPY_Process_Type);
+	return 1;
+}
+
+static PyObject* _EBoxPY_Create_Process(unsigned long _ID, PyObject* _Name) {
 	PyObject* output = EBoxPY_Process_Type.tp_alloc(&EBoxPY_Process_Type, 1);
-	if (!output) {
-		CloseHandle(information.hProcess);
-		Py_DECREF(thread);
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.StartProcess Failed to Allocate EBoxPY.Process.");
+	if (!output)
+		return NULL;
+	EBOXPY_OBJECT_ZERO(EBoxPY_Process, output);
+	PEBoxPY_Process process = (PEBoxPY_Process)output;
+	process->Process_ = NULL;
+	process->IsOpen_ = (char)0;
+	process->ID_ = _ID;
+	Py_INCREF(_Name);
+	process->Name_ = _Name;
+	if (_ID == GetCurrentProcessId()) {
+		process->Self_ = _EBoxPY_Self_Create();
+		process->IsSelf_ = (char)(process->Self_ != NULL);
+	}
+	return output;
+}
+
+static PyObject* _EBoxPY_GetProcessNameFromID(unsigned long _ID) {
+	HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
+	if (!snapshot || snapshot == INVALID_HANDLE_VALUE) {
+		return NULL;
+	}
+	PROCESSENTRY32W entry = {0};
+	entry.dwSize = sizeof(PROCESSENTRY32W);
+	for (BOOL b = Process32FirstW(snapshot, &entry); b == TRUE; b = Process32NextW(snapshot, &entry)) {
+		if (entry.th32ProcessID == _ID) {
+			CloseHandle(snapshot);
+			return PyUnicode_FromWideChar(entry.szExeFile, -1);
+		}
+	}
+	CloseHandle(snapshot);
+	return NULL;
+}
+
+static PyObject* EBoxPY_StartProcess(PyObject* self, PyObject* args) {
+	if (PyTuple_Size(args) != 2) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.StartProcess Takes 2 Arguments.");
+		return NULL;
+	}
+	PyObject* _Executable = PyTuple_GetItem(args, 0);
+	PyObject* _Suspended = PyTuple_GetItem(args, 1);
+	if (!PyUnicode_Check(_Executable)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.StartProcess Requires _Executable to be str.");
+		return NULL;
+	}
+	if (!PyBool_Check(_Suspended)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.StartProcess Requires _Suspended to be bool.");
+		return NULL;
+	}
+	int suspended = PyObject_IsTrue(_Suspended);
+	Py_ssize_t length = 0;
+	wchar_t* executable = PyUnicode_AsWideCharString(_Executable, &length);
+	if (!executable) {
+		return NULL;
+	}
+	STARTUPINFOW startup = {0};
+	startup.cb = sizeof(STARTUPINFOW);
+	PROCESS_INFORMATION information = {0};
+	if (!CreateProcessW(NULL, executable, NULL, NULL, FALSE, (suspended ? CREATE_SUSPENDED : 0), NULL, NULL, &startup, &information)) {
+		PyMem_Free(executable);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.StartProcess Failed to Start Process.");
+		return NULL;
+	}
+	PyMem_Free(executable);
+	PyObject* thread = _EBoxPY_Create_Thread_Handle(information.hThread);
+	if (!thread){
+		CloseHandle(information.hProcess);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.StartProcess Failed to Create Thread.");
+		return NULL;
+	}
+	if (suspended) {
+		if (!_EBoxPY_Thread_Lock((PEBoxPY_Thread)thread, EBOXPY_CONTEXT_ALL)) {
+			CloseHandle(information.hProcess);
+			Py_DECREF(thread);
+			return NULL;
+		}
+		ResumeThread(information.hThread); // Because EBoxPY_Thread_Lock suspends!
+	}
+	PyObject* output = EBoxPY_Process_Type.tp_alloc(&EBoxPY_Process_Type, 1);
+	if (!output) {
+		CloseHandle(information.hProcess);
+		Py_DECREF(thread);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.StartProcess Failed to Allocate EBoxPY.Process.");
+		return NULL;
+	}
+	EBOXPY_OBJECT_ZERO(EBoxPY_Process, output);
+	PEBoxPY_Process process = (PEBoxPY_Process)output;
+	process->ID_ = (unsigned long)information.dwProcessId;
+	process->IsOpen_ = 1;
+	process->Process_ = information.hProcess;
+	process->Name_ = _EBoxPY_GetProcessNameFromID(process->ID_);
+	if (!process->Name_) {
+		Py_DECREF(thread);
+		Py_DECREF(output);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.StartProcess Failed to Get Process Name from ID.");
+		return NULL;
+	}
+	return PyTuple_Pack(2, output, thread);
+}
+
+static void EBoxPY_Process_dealloc(PyObject* self) {
+	PEBoxPY_Process process = (PEBoxPY_Process)self;
+	Py_XDECREF(process->Name_);
+	_EBoxPY_Freezer_Destroy(process->Freezer_);
+	_EBoxPY_Unwind_Destroy(process->Unwind_);
+	_EBoxPY_Self_Destroy(process->Self_);
+	free(process->Bounce_);
+	free(process->Threads_);
+	if (process->Dump_)
+		_EBoxPY_Dump_Close(process->Dump_);
+	else if (process->IsOpen_)
+		CloseHandle(process->Process_);
+	Py_TYPE(self)->tp_free(self);
+}
+
+static PyObject* EBoxPY_Process_repr(PyObject* self) {
+	PEBoxPY_Process process = (PEBoxPY_Process)self;
+	PyObject* encoded = PyUnicode_AsEncodedString(process->Name_, "UTF-8", "strict");
+	if (!encoded)
+		return NULL;
+	char* name = PyBytes_AS_STRING(encoded);
+	char output[512];
+	sprintf(output, "<EBoxPY.Process: (%s)>", name);
+	Py_DECREF(encoded);
+	return PyUnicode_FromString(output);
+}
+
+static PyObject* EBoxPY_Process_Open(PEBoxPY_Process self) {
+	if (self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was already True.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True, use EBoxPY.OpenDump.");
+		return NULL;
+	}
+	self->Process_ = OpenProcess(PROCESS_ALL_ACCESS, FALSE, (DWORD)self->ID_);
+	if (!self->Process_ || self->Process_ == INVALID_HANDLE_VALUE) {
+		self->Process_ = NULL;
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process failed to open Process, OpenProcess failed.");
+		return NULL;
+	}
+	self->IsOpen_ = (char)1;
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Process_Close(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was already False.");
+		return NULL;
+	}
+	if (self->Pending_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process has pending operations running without the GIL.");
+		return NULL;
+	}
+	_EBoxPY_Freezer_Destroy(self->Freezer_);
+	self->Freezer_ = NULL;
+	if (self->Dump_) {
+		_EBoxPY_Dump_Close(self->Dump_);
+		self->Dump_ = NULL;
+	}
+	else {
+		CloseHandle(self->Process_);
+	}
+	self->Process_ = NULL;
+	self->IsOpen_ = (char)0;
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+// Runs without the GIL, the Process must be pinned. Returns 0 only when the Toolhelp32 Snapshot could not be taken.
+static int _EBoxPY_Process_Collect_Modules(PEBoxPY_Process _Process, _PEBoxPY_Module_Record* _Records, unsigned long long* _Count) {
+	*_Records = NULL;
+	*_Count = 0;
+	_EBoxPY_Dump_Vector records = {0};
+	if (_Process->Dump_) {
+		for (unsigned long long i = 0; i < _Process->Dump_->Header_->ModuleCount_; ++i) {
+			_PEBoxPY_Module_Record record = (_PEBoxPY_Module_Record)_EBoxPY_Dump_Vector_Add(&records, sizeof(_EBoxPY_Module_Record));
+			if (!record)
+				break;
+			memset(record, 0, sizeof(_EBoxPY_Module_Record));
+			record->Address_ = _Process->Dump_->Modules_[i].Address_;
+			record->Size_ = _Process->Dump_->Modules_[i].Size_;
+			memcpy(record->Name_, _Process->Dump_->Modules_[i].Name_, sizeof(record->Name_) - sizeof(wchar_t));
+			memcpy(record->Path_, _Process->Dump_->Modules_[i].Path_, sizeof(record->Path_) - sizeof(wchar_t));
+			if (!_EBoxPY_Module_Record_Load((PyObject*)_Process, record))
+				--records.Count_;
+		}
+	}
+	else {
+		HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPMODULE | TH32CS_SNAPMODULE32, (DWORD)_Process->ID_);
+		if (!snapshot || snapshot == INVALID_HANDLE_VALUE)
+			return 0;
+		MODULEENTRY32W entry = {0};
+		entry.dwSize = sizeof(MODULEENTRY32W);
+		for (BOOL b = Module32FirstW(snapshot, &entry); b == TRUE; b = Module32NextW(snapshot, &entry)) {
+			_PEBoxPY_Module_Record record = (_PEBoxPY_Module_Record)_EBoxPY_Dump_Vector_Add(&records, sizeof(_EBoxPY_Module_Record));
+			if (!record)
+				break;
+			memset(record, 0, sizeof(_EBoxPY_Module_Record));
+			record->Address_ = (unsigned long long)entry.modBaseAddr;
+			record->Size_ = (unsigned long long)entry.modBaseSize;
+			memcpy(record->Name_, entry.szModule, sizeof(record->Name_));
+			memcpy(record->Path_, entry.szExePath, sizeof(record->Path_));
+			if (!_EBoxPY_Module_Record_Load((PyObject*)_Process, record))
+				--records.Count_;
+		}
+		CloseHandle(snapshot);
+	}
+	*_Records = (_PEBoxPY_Module_Record)records.Data_;
+	*_Count = records.Count_;
+	return 1;
+}
+
+// Frees the records as it goes.
+static PyObject* _EBoxPY_Process_Modules_Dictionary(PEBoxPY_Process _Process, _PEBoxPY_Module_Record _Records, unsigned long long _Count) {
+	PyObject* dictionary = PyDict_New();
+	for (unsigned long long i = 0; i < _Count; ++i) {
+		PyObject* _module = (dictionary ? _EBoxPY_Create_Module_Record((PyObject*)_Process, &_Records[i]) : NULL);
+		if (_module) {
+			PyDict_SetItem(dictionary, ((PEBoxPY_Module)_module)->Name_, _module);
+			Py_DECREF(_module);
+		}
+		_EBoxPY_Module_Record_Free(&_Records[i]);
+	}
+	free(_Records);
+	if (!dictionary) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.GetModules failed to Create Dictionary.");
+		return NULL;
+	}
+	PyErr_Clear();
+	return dictionary;
+}
+
+static PyObject* EBoxPY_Process_GetModules(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	_PEBoxPY_Module_Record records = NULL;
+	unsigned long long count = 0;
+	int status = 0;
+	if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+	status = _EBoxPY_Process_Collect_Modules(self, &records, &count);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Process_Unpin((PyObject*)self);
+	if (!status) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.GetModules failed to Create Toolhelp32 Snapshot, CreateToolhelp32Snapshot failed.");
+		return NULL;
+	}
+	return _EBoxPY_Process_Modules_Dictionary(self, records, count);
+}
+
+static PyObject* EBoxPY_Process_GetRegion(PEBoxPY_Process self, PyObject* address) {
+	if (!PyLong_Check(address)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.GetRegion requires _Address to be of type int.");
+		return NULL;
+	}
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	return _EBoxPY_Create_Region((PyObject*)self, PyLong_AsUnsignedLongLong(address));
+}
+
+// Called with the GIL held, Close refuses to run until the matching Unpin so the handle and Dump_ outlive the released GIL.
+static int _EBoxPY_Process_Pin(PyObject* _Process) {
+	PEBoxPY_Process process = (PEBoxPY_Process)_Process;
+	if (!process->IsOpen_)
+		return 0;
+	InterlockedIncrement(&process->Pending_);
+	return 1;
+}
+
+static void _EBoxPY_Process_Unpin(PyObject* _Process) {
+	InterlockedDecrement(&((PEBoxPY_Process)_Process)->Pending_);
+}
+
+static int _EBoxPY_Process_Read(PyObject* _Process, unsigned long long _Address, void* _Buffer, unsigned long long _Size) {
+	PEBoxPY_Process process = (PEBoxPY_Process)_Process;
+	if (!process->IsOpen_)
+		return 0;
+	if (process->Dump_)
+		return _EBoxPY_Dump_Read(process->Dump_, _Address, _Buffer, _Size);
+	if (process->Self_) {
+		int status = _EBoxPY_Self_Transfer(process->Self_, 0, _Address, _Buffer, _Size);
+		if (status >= 0)
+			return status;
+	}
+	return ReadProcessMemory(process->Process_, (void*)_Address, _Buffer, (SIZE_T)_Size, NULL) != FALSE;
+}
+
+static int _EBoxPY_Process_Query(PyObject* _Process, unsigned long long _Address, MEMORY_BASIC_INFORMATION* _Information, char* _Backed) {
+	PEBoxPY_Process process = (PEBoxPY_Process)_Process;
+	if (!process->IsOpen_)
+		return 0;
+	if (process->Dump_)
+		return _EBoxPY_Dump_Query(process->Dump_, _Address, _Information, _Backed);
+	if (process->Self_) {
+		if (VirtualQuery((LPCVOID)_Address, _Information, sizeof(MEMORY_BASIC_INFORMATION)) == 0)
+			return 0;
+	}
+	else if (VirtualQueryEx(process->Process_, (void*)_Address, _Information, sizeof(MEMORY_BASIC_INFORMATION)) == 0)
+		return 0;
+	if (_Backed) {
+		PSAPI_WORKING_SET_EX_INFORMATION set = { 0 };
+		set.VirtualAddress = _Information->BaseAddress;
+		if (!QueryWorkingSetEx(process->Process_, &set, sizeof(PSAPI_WORKING_SET_EX_INFORMATION)))
+			return 0;
+		*_Backed = (char)(set.VirtualAttributes.Valid ? 1 : 0);
+	}
+	return 1;
+}
+
+/*
+static PyObject* EBoxPY_Process_Read(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (PyTuple_Size(args) != 2) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Read requires 2 arguments.");
+		return NULL;
+	}
+	if (!PyLong_Check(PyTuple_GetItem(args, 0))) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Read requires _Address to be int.");
+		return NULL;
+	}
+	if (!PyLong_Check(PyTuple_GetItem(args, 1))) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Read requires _Type to be int.");
+		return NULL;
+	}
+	unsigned long long address = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 0));
+	if (PyErr_Occurred()) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Read requires a valid int _Address.");
+		return NULL;
+	}
+	unsigned long long size = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 1));
+	if (PyErr_Occurred()) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Read requires a valid int _Size.");
+		return NULL;
+	}
+	PyObject* output = _EBoxPY_Create_Bytes(size);
+	if (!output) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Read failed to create Bytes.");
+		return NULL;
+	}
+	PyObject* _args = PyTuple_Pack(2, PyTuple_GetItem(args, 0), output);
+	PyObject* result = EBoxPY_Process_ReadTo(self, _args);
+	Py_DECREF(_args);
+	if (!result) {
+		Py_DECREF(output);
+		return NULL;
+	}
+	else {
+		Py_DECREF(result);
+		return output;
+	}
+}
+*/
+
+static int _EBoxPY_Process_Write(PyObject* _Process, unsigned long long _Address, const void* _Buffer, unsigned long long _Size) {
+	PEBoxPY_Process process = (PEBoxPY_Process)_Process;
+	if (!process->IsOpen_ || process->IsDump_)
+		return 0;
+	// Writes into read-only pages such as code still go through WriteProcessMemory, which handles the protection.
+	if (process->Self_) {
+		int status = _EBoxPY_Self_Transfer(process->Self_, 1, _Address, (void*)_Buffer, _Size);
+		if (status >= 0)
+			return status;
+	}
+	return WriteProcessMemory(process->Process_, (void*)_Address, _Buffer, (SIZE_T)_Size, NULL) != FALSE;
+}
+
+static int _EBoxPY_Process_Collect_Regions(PyObject* _Process, MEMORY_BASIC_INFORMATION** _Regions, unsigned long long* _Count) {
+	unsigned long long capacity = 256;
+	*_Count = 0;
+	*_Regions = (MEMORY_BASIC_INFORMATION*)malloc(capacity * sizeof(MEMORY_BASIC_INFORMATION));
+	if (!*_Regions)
+		return 0;
+	MEMORY_BASIC_INFORMATION information = {0};
+	for (unsigned long long address = 0; _EBoxPY_Process_Query(_Process, address, &information, NULL); address = (unsigned long long)information.BaseAddress + information.RegionSize) {
+		if (*_Count == capacity) {
+			MEMORY_BASIC_INFORMATION* regions = (MEMORY_BASIC_INFORMATION*)realloc(*_Regions, capacity * 2 * sizeof(MEMORY_BASIC_INFORMATION));
+			if (!regions) {
+				free(*_Regions);
+				*_Regions = NULL;
+				return 0;
+			}
+			*_Regions = regions;
+			capacity *= 2;
+		}
+		(*_Regions)[(*_Count)++] = information;
+		if (!information.RegionSize)
+			break;
+	}
+	return 1;
+}
+
+// Fills _Backed for every Region with a single working set query.
+static int _EBoxPY_Process_Collect_Backed(PyObject* _Process, const MEMORY_BASIC_INFORMATION* _Regions, unsigned long long _Count, char* _Backed) {
+	PEBoxPY_Process process = (PEBoxPY_Process)_Process;
+	if (process->Dump_) {
+		MEMORY_BASIC_INFORMATION information;
+		for (unsigned long long i = 0; i < _Count; ++i) {
+			if (!_EBoxPY_Dump_Query(process->Dump_, (unsigned long long)_Regions[i].BaseAddress, &information, &_Backed[i]))
+				_Backed[i] = 0;
+		}
+		return 1;
+	}
+	PSAPI_WORKING_SET_EX_INFORMATION* set = (PSAPI_WORKING_SET_EX_INFORMATION*)calloc(_Count + 1, sizeof(PSAPI_WORKING_SET_EX_INFORMATION));
+	if (!set)
+		return 0;
+	for (unsigned long long i = 0; i < _Count; ++i)
+		set[i].VirtualAddress = _Regions[i].BaseAddress;
+	if (_Count && !QueryWorkingSetEx(process->Process_, set, (DWORD)(_Count * sizeof(PSAPI_WORKING_SET_EX_INFORMATION)))) {
+		free(set);
+		return 0;
+	}
+	for (unsigned long long i = 0; i < _Count; ++i)
+		_Backed[i] = (char)(set[i].VirtualAttributes.Valid ? 1 : 0);
+	free(set);
+	return 1;
+}
+
+static PyObject* _EBoxPY_Process_Regions_List(const MEMORY_BASIC_INFORMATION* _Regions, const char* _Backed, unsigned long long _Count) {
+	PyObject* output = PyList_New((Py_ssize_t)_Count);
+	if (!output)
+		return NULL;
+	for (unsigned long long i = 0; i < _Count; ++i) {
+		PyObject* region = _EBoxPY_Create_Region_Information(&_Regions[i], _Backed[i]);
+		if (!region) {
+			Py_DECREF(output);
+			return NULL;
+		}
+		PyList_SET_ITEM(output, (Py_ssize_t)i, region);
+	}
+	return output;
+}
+
+static int _EBoxPY_Process_Collect_Regions_Backed(PyObject* _Process, MEMORY_BASIC_INFORMATION** _Regions, char** _Backed, unsigned long long* _Count) {
+	if (!_EBoxPY_Process_Collect_Regions(_Process, _Regions, _Count))
+		return 0;
+	*_Backed = (char*)malloc(*_Count + 1);
+	if (!*_Backed || !_EBoxPY_Process_Collect_Backed(_Process, *_Regions, *_Count, *_Backed)) {
+		free(*_Regions);
+		free(*_Backed);
+		*_Regions = NULL;
+		*_Backed = NULL;
+		return 0;
+	}
+	return 1;
+}
+
+static PyObject* EBoxPY_Process_GetRegions(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	MEMORY_BASIC_INFORMATION* regions = NULL;
+	char* backed = NULL;
+	unsigned long long count = 0;
+	int status = 0;
+	Py_BEGIN_ALLOW_THREADS
+	status = _EBoxPY_Process_Collect_Regions_Backed((PyObject*)self, &regions, &backed, &count);
+	Py_END_ALLOW_THREADS
+	if (!status) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.GetRegions failed to Query Regions.");
+		return NULL;
+	}
+	PyObject* output = _EBoxPY_Process_Regions_List(regions, backed, count);
+	free(regions);
+	free(backed);
+	return output;
+}
+
+static PyObject* EBoxPY_Process_ReadTo(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (PyTuple_Size(args) != 4) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires 2 arguments.");
+		return NULL;
+	}
+	if (!PyLong_Check(PyTuple_GetItem(args, 0))) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires _Address to be int.");
+		return NULL;
+	}
+	if (!PyObject_IsInstance(PyTuple_GetItem(args, 1), (PyObject*)&EBoxPY_Bytes_Type)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires _Bytes to be a Bytes object.");
+		return NULL;
+	}
+	if (!PyLong_Check(PyTuple_GetItem(args, 2))) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires _Start to be int.");
+		return NULL;
+	}
+	if (!PyLong_Check(PyTuple_GetItem(args, 3))) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires _Size to be int.");
+		return NULL;
+	}
+	unsigned long long address = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 0));
+	if (PyErr_Occurred()) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires a valid int _Address.");
+		return NULL;
+	}
+	PEBoxPY_Bytes bytes = (PEBoxPY_Bytes)PyTuple_GetItem(args, 1);
+	unsigned long long start = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 2));
+	if (PyErr_Occurred()) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires a valid int _Start.");
+		return NULL;
+	}
+	unsigned long long size = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 3));
+	if (PyErr_Occurred()) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires a valid int _Size.");
+		return NULL;
+	}
+	if (start + size > bytes->Size_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.ReadTo address out of bounds.");
+		return NULL;
+	}
+	if (!_EBoxPY_Process_Read((PyObject*)self, address, bytes->Allocation_ + start, size)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.ReadTo failed to Read memory.");
+		return NULL;
+	}
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Process_WriteFrom(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	if (PyTuple_Size(args) != 4) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.WriteFrom requires 2 arguments.");
+		return NULL;
+	}
+	if (!PyLong_Check(PyTuple_GetItem(args, 0))) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.WriteFrom requires _Address to be int.");
+		return NULL;
+	}
+	if (!PyObject_IsInstance(PyTuple_GetItem(args, 1), (PyObject*)&EBoxPY_Bytes_Type)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.WriteFrom requires _Bytes to be a Bytes object.");
+		return NULL;
+	}
+	unsigned long long address = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 0));
+	if (PyErr_Occurred()) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.WriteFrom requires a valid int _Address.");
+		return NULL;
+	}
+	PEBoxPY_Bytes bytes = (PEBoxPY_Bytes)PyTuple_GetItem(args, 1);
+	unsigned long long start = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 2));
+	if (PyErr_Occurred()) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.WriteFrom requires a valid int _Start.");
+		return NULL;
+	}
+	unsigned long long size = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 3));
+	if (PyErr_Occurred()) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.WriteFrom requires a valid int _Size.");
+		return NULL;
+	}
+	if (start + size > bytes->Size_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.WriteFrom address out of bounds.");
+		return NULL;
+	}
+	if (!_EBoxPY_Process_Write((PyObject*)self, address, bytes->Allocation_ + start, size)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.WriteFrom failed to Write memory.");
+		return NULL;
+	}
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Process_View(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (!self->IsSelf_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsSelf_ was False.");
+		return NULL;
+	}
+	unsigned long long address = 0;
+	unsigned long long size = 0;
+	if (!PyArg_ParseTuple(args, "KK", &address, &size))
+		return NULL;
+	if (!_EBoxPY_Self_Covered(self->Self_, &self->Self_->Readable_, address, size)) {
+		_EBoxPY_Self_Patch(self->Self_, address, size);
+		if (!_EBoxPY_Self_Covered(self->Self_, &self->Self_->Readable_, address, size)) {
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.View requires _Address to _Address + _Size to be readable.");
+			return NULL;
+		}
+	}
+	PyObject* output = EBoxPY_Bytes_Type.tp_alloc(&EBoxPY_Bytes_Type, 1);
+	if (!output)
+		return NULL;
+	EBOXPY_OBJECT_ZERO(EBoxPY_Bytes, output);
+	PEBoxPY_Bytes bytes = (PEBoxPY_Bytes)output;
+	bytes->Allocation_ = (unsigned char*)address;
+	bytes->Size_ = size;
+	bytes->IsView_ = (char)1;
+	bytes->IsWritable_ = (char)_EBoxPY_Self_Covered(self->Self_, &self->Self_->Writable_, address, size);
+	Py_INCREF(self);
+	bytes->Owner_ = (PyObject*)self;
+	return output;
+}
+
+#define EBOXPY_BOUNCE_SIZE 0x100000
+
+// The Process keeps one bounce buffer, a concurrent caller that finds it busy gets a temporary one instead of waiting.
+static unsigned char* _EBoxPY_Bounce_Acquire(PEBoxPY_Process _Process) {
+	if (TryAcquireSRWLockExclusive(&_Process->BounceLock_)) {
+		if (!_Process->Bounce_)
+			_Process->Bounce_ = (unsigned char*)malloc(EBOXPY_BOUNCE_SIZE);
+		if (_Process->Bounce_)
+			return _Process->Bounce_;
+		ReleaseSRWLockExclusive(&_Process->BounceLock_);
+	}
+	return (unsigned char*)malloc(EBOXPY_BOUNCE_SIZE);
+}
+
+static void _EBoxPY_Bounce_Release(PEBoxPY_Process _Process, unsigned char* _Buffer) {
+	if (_Buffer && _Buffer == _Process->Bounce_)
+		ReleaseSRWLockExclusive(&_Process->BounceLock_);
+	else
+		free(_Buffer);
+}
+
+static int _EBoxPY_Process_Copy(PEBoxPY_Process _Process, unsigned char* _Buffer, unsigned long long _Destination, unsigned long long _Source, unsigned long long _Size) {
+	// A Destination inside the Source is copied from the end so no chunk reads bytes that were already overwritten.
+	int backward = (_Destination > _Source && _Destination - _Source < _Size);
+	for (unsigned long long done = 0; done < _Size;) {
+		unsigned long long chunk = (_Size - done < EBOXPY_BOUNCE_SIZE ? _Size - done : EBOXPY_BOUNCE_SIZE);
+		unsigned long long offset = (backward ? _Size - done - chunk : done);
+		if (!_EBoxPY_Process_Read((PyObject*)_Process, _Source + offset, _Buffer, chunk) || !_EBoxPY_Process_Write((PyObject*)_Process, _Destination + offset, _Buffer, chunk))
+			return 0;
+		done += chunk;
+	}
+	return 1;
+}
+
+static int _EBoxPY_Process_Fill(PEBoxPY_Process _Process, unsigned char* _Buffer, unsigned long long _Address, unsigned char _Byte, unsigned long long _Size) {
+	memset(_Buffer, _Byte, (size_t)(_Size < EBOXPY_BOUNCE_SIZE ? _Size : EBOXPY_BOUNCE_SIZE));
+	for (unsigned long long done = 0; done < _Size;) {
+		unsigned long long chunk = (_Size - done < EBOXPY_BOUNCE_SIZE ? _Size - done : EBOXPY_BOUNCE_SIZE);
+		if (!_EBoxPY_Process_Write((PyObject*)_Process, _Address + done, _Buffer, chunk))
+			return 0;
+		done += chunk;
+	}
+	return 1;
+}
+
+// Returns 0 on a failed Read, otherwise 1 with _Difference set to the first differing offset or -1.
+static int _EBoxPY_Process_Compare(PEBoxPY_Process _Process, unsigned char* _Buffer, unsigned long long _Address, const unsigned char* _Data, unsigned long long _Size, long long* _Difference) {
+	*_Difference = -1;
+	for (unsigned long long done = 0; done < _Size;) {
+		unsigned long long chunk = (_Size - done < EBOXPY_BOUNCE_SIZE ? _Size - done : EBOXPY_BOUNCE_SIZE);
+		if (!_EBoxPY_Process_Read((PyObject*)_Process, _Address + done, _Buffer, chunk))
+			return 0;
+		if (memcmp(_Buffer, _Data + done, (size_t)chunk)) {
+			for (unsigned long long i = 0; i < chunk; ++i) {
+				if (_Buffer[i] != _Data[done + i]) {
+					*_Difference = (long long)(done + i);
+					return 1;
+				}
+			}
+		}
+		done += chunk;
+	}
+	return 1;
+}
+
+static PyObject* EBoxPY_Process_Copy(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	unsigned long long destination = 0;
+	unsigned long long source = 0;
+	unsigned long long size = 0;
+	if (!PyArg_ParseTuple(args, "KKK", &destination, &source, &size))
+		return NULL;
+	int status = 0;
+	if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+	unsigned char* buffer = _EBoxPY_Bounce_Acquire(self);
+	status = (buffer ? _EBoxPY_Process_Copy(self, buffer, destination, source, size) : -1);
+	_EBoxPY_Bounce_Release(self, buffer);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Process_Unpin((PyObject*)self);
+	if (status < 0) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Copy failed to Allocate the bounce buffer.");
+		return NULL;
+	}
+	if (!status) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Copy failed to Read or Write memory.");
+		return NULL;
+	}
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Process_Fill(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	unsigned long long address = 0;
+	unsigned char byte = 0;
+	unsigned long long size = 0;
+	if (!PyArg_ParseTuple(args, "KbK", &address, &byte, &size))
+		return NULL;
+	int status = 0;
+	if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+	unsigned char* buffer = _EBoxPY_Bounce_Acquire(self);
+	status = (buffer ? _EBoxPY_Process_Fill(self, buffer, address, byte, size) : -1);
+	_EBoxPY_Bounce_Release(self, buffer);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Process_Unpin((PyObject*)self);
+	if (status < 0) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Fill failed to Allocate the bounce buffer.");
+		return NULL;
+	}
+	if (!status) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Fill failed to Write memory.");
+		return NULL;
+	}
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Process_Compare(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	unsigned long long address = 0;
+	PyObject* _bytes = NULL;
+	if (!PyArg_ParseTuple(args, "KO", &address, &_bytes))
+		return NULL;
+	// Compared against a private copy, another Thread may re-initialize the Bytes while the GIL is released.
+	unsigned long long size = 0;
+	unsigned char* data = _EBoxPY_Bytes_Duplicate(_bytes, &size);
+	if (!data)
+		return NULL;
+	long long difference = -1;
+	int status = 0;
+	if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+		free(data);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+	unsigned char* buffer = _EBoxPY_Bounce_Acquire(self);
+	status = (buffer ? _EBoxPY_Process_Compare(self, buffer, address, data, size, &difference) : -1);
+	_EBoxPY_Bounce_Release(self, buffer);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Process_Unpin((PyObject*)self);
+	free(data);
+	if (status < 0) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Compare failed to Allocate the bounce buffer.");
+		return NULL;
+	}
+	if (!status) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Compare failed to Read memory.");
+		return NULL;
+	}
+	return PyLong_FromLongLong(difference);
+}
+
+static PyObject* _EBoxPY_Process_GetThreads_Dump(PEBoxPY_Process self) {
+	PyObject* output = PyList_New(0);
+	if (!output) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.GetThreads Failed to Create output list.");
+		return NULL;
+	}
+	for (unsigned long long i = 0; i < self->Dump_->Header_->ThreadCount_; ++i) {
+		_PEBoxPY_Dump_Thread entry = &self->Dump_->Threads_[i];
+		PyObject* thread = _EBoxPY_Create_Thread_ID((unsigned long)entry->ID_);
+		if (!thread)
+			continue;
+		if (entry->Valid_) {
+			CONTEXT context;
+			memcpy(&context, &entry->Context_, sizeof(CONTEXT));
+			_EBoxPY_Thread_Add_Context(((PEBoxPY_Thread)thread)->Registers_, &context, EBOXPY_CONTEXT_ALL);
+		}
+		PyList_Append(output, thread);
+		Py_DECREF(thread);
+	}
+	return output;
+}
+
+static int _EBoxPY_Process_Query_Threads(PEBoxPY_Process self, _PEBoxPY_Thread_Record* _Records, unsigned long long* _Count) {
+	int status = 0;
+	Py_BEGIN_ALLOW_THREADS
+	status = _EBoxPY_System_Threads(self->ID_, _Records, _Count);
+	Py_END_ALLOW_THREADS
+	if (!status) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process failed to Query Threads, NtQuerySystemInformation failed.");
+		return 0;
+	}
+	return 1;
+}
+
+static PyObject* _EBoxPY_Process_Threads_List(_PEBoxPY_Thread_Record _Records, unsigned long long _Count) {
+	PyObject* output = PyList_New(0);
+	if (!output) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.GetThreads Failed to Create output list.");
+		return NULL;
+	}
+	for (unsigned long long i = 0; i < _Count; ++i) {
+		PyObject* thread = _EBoxPY_Create_Thread_ID(_Records[i].ID_);
+		if (!thread)
+			continue;
+		PyList_Append(output, thread);
+		Py_DECREF(thread);
+	}
+	return output;
+}
+
+static PyObject* EBoxPY_Process_GetThreads(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->Dump_)
+		return _EBoxPY_Process_GetThreads_Dump(self);
+	_PEBoxPY_Thread_Record records = NULL;
+	unsigned long long count = 0;
+	if (!_EBoxPY_Process_Query_Threads(self, &records, &count))
+		return NULL;
+	PyObject* output = _EBoxPY_Process_Threads_List(records, count);
+	free(records);
+	return output;
+}
+
+static PyObject* EBoxPY_Process_RefreshThreads(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	_PEBoxPY_Thread_Record records = NULL;
+	unsigned long long count = 0;
+	if (!_EBoxPY_Process_Query_Threads(self, &records, &count))
+		return NULL;
+	// Threads_ is the baseline of RefreshThreads alone, it only moves once both lists are built.
+	PyObject* created = PyList_New(0);
+	PyObject* exited = PyList_New(0);
+	if (!created || !exited || !_EBoxPY_Diff_Records(self->Threads_, self->ThreadCount_, records, count, created, exited)) {
+		free(records);
+		Py_XDECREF(created);
+		Py_XDECREF(exited);
+		return NULL;
+	}
+	free(self->Threads_);
+	self->Threads_ = records;
+	self->ThreadCount_ = count;
+	PyObject* output = PyTuple_Pack(2, created, exited);
+	Py_DECREF(created);
+	Py_DECREF(exited);
+	return output;
+}
+
+typedef long (WINAPI* _EBoxPY_NtSuspendProcess)(HANDLE);
+
+static int _EBoxPY_Process_Suspend(HANDLE _Process, int _Resume) {
+	static _EBoxPY_NtSuspendProcess suspend = NULL;
+	static _EBoxPY_NtSuspendProcess resume = NULL;
+	if (!suspend || !resume) {
+		suspend = (_EBoxPY_NtSuspendProcess)_EBoxPY_Ntdll("NtSuspendProcess");
+		resume = (_EBoxPY_NtSuspendProcess)_EBoxPY_Ntdll("NtResumeProcess");
+	}
+	if (!suspend || !resume)
+		return 0;
+	return (_Resume ? resume(_Process) : suspend(_Process)) >= 0;
+}
+
+static PyObject* EBoxPY_Process_Suspend(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	if (!_EBoxPY_Process_Suspend(self->Process_, 0)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Suspend failed, NtSuspendProcess failed.");
+		return NULL;
+	}
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Process_Resume(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	if (!_EBoxPY_Process_Suspend(self->Process_, 1)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Resume failed, NtResumeProcess failed.");
+		return NULL;
+	}
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+// Runs without the GIL, the Process stays Suspended so no Thread runs between the Context Get and Set.
+static unsigned long long _EBoxPY_Process_Apply_Breakpoint(PEBoxPY_Process _Process, unsigned long _Index) {
+	_EBoxPY_Breakpoint breakpoints[4];
+	AcquireSRWLockExclusive(&_Process->BreakpointLock_);
+	memcpy(breakpoints, _Process->Breakpoints_, sizeof(breakpoints));
+	ReleaseSRWLockExclusive(&_Process->BreakpointLock_);
+	// The caller pins Pending_, the handle is still read once so the Resume always matches the Suspend.
+	HANDLE process = _Process->Process_;
+	if (!_EBoxPY_Process_Suspend(process, 0))
+		return 0;
+	unsigned long long updated = 0;
+	_PEBoxPY_Thread_Record threads = NULL;
+	unsigned long long count = 0;
+	if (_EBoxPY_System_Threads(_Process->ID_, &threads, &count)) {
+		for (unsigned long long i = 0; i < count; ++i) {
+			HANDLE thread = OpenThread(THREAD_GET_CONTEXT | THREAD_SET_CONTEXT, FALSE, (DWORD)threads[i].ID_);
+			if (!thread)
+				continue;
+			updated += _EBoxPY_Breakpoint_Apply(thread, breakpoints, 1 << _Index);
+			CloseHandle(thread);
+		}
+		free(threads);
+	}
+	_EBoxPY_Process_Suspend(process, 1);
+	return updated;
+}
+
+static PyObject* EBoxPY_Process_SetBreakpointAll(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	int index = 0;
+	unsigned long long address = 0;
+	int conditions = 0;
+	unsigned long long length = 1;
+	if (!PyArg_ParseTuple(args, "iKi|K", &index, &address, &conditions, &length))
+		return NULL;
+	if (index < 0 || index > 3) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process Requires _Index >= 0 && _Index <= 3.");
+		return NULL;
+	}
+	if (conditions != EBOXPY_BREAK_ACCESS && conditions != EBOXPY_BREAK_EXECUTE && conditions != EBOXPY_BREAK_WRITE) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process Requires _Conditions to be EBoxPY.ACCESS, EXECUTE, WRITE");
+		return NULL;
+	}
+	unsigned long long bits = 0;
+	if (!_EBoxPY_Breakpoint_Length(length, &bits) || (conditions == EBOXPY_BREAK_EXECUTE && length != 1)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process Requires _Length to be 1, 2, 4 or 8, and 1 for EBoxPY.EXECUTE.");
+		return NULL;
+	}
+	AcquireSRWLockExclusive(&self->BreakpointLock_);
+	self->Breakpoints_[index].Address_ = address;
+	self->Breakpoints_[index].Control_ = EBOXPY_BREAKPOINT(index, conditions | (bits << 2));
+	ReleaseSRWLockExclusive(&self->BreakpointLock_);
+	unsigned long long updated = 0;
+	if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+	updated = _EBoxPY_Process_Apply_Breakpoint(self, (unsigned long)index);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Process_Unpin((PyObject*)self);
+	return PyLong_FromUnsignedLongLong(updated);
+}
+
+static PyObject* EBoxPY_Process_RemoveBreakpointAll(PEBoxPY_Process self, PyObject* index) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	if (!PyLong_Check(index)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process Requires _Index to be int.");
+		return NULL;
+	}
+	long _index = PyLong_AsLong(index);
+	if (_index < 0 || _index > 3) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process Requires _Index >= 0 && _Index <= 3.");
+		return NULL;
+	}
+	AcquireSRWLockExclusive(&self->BreakpointLock_);
+	self->Breakpoints_[_index].Address_ = 0;
+	self->Breakpoints_[_index].Control_ = 0;
+	ReleaseSRWLockExclusive(&self->BreakpointLock_);
+	unsigned long long updated = 0;
+	if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+	updated = _EBoxPY_Process_Apply_Breakpoint(self, (unsigned long)_index);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Process_Unpin((PyObject*)self);
+	return PyLong_FromUnsignedLongLong(updated);
+}
+
+typedef struct _EBoxPY_Capture_T {
+	HANDLE Process_;
+	unsigned long ID_;
+	_PEBoxPY_Thread_Record Threads_;
+	unsigned long long ThreadCount_;
+	CONTEXT* Contexts_;
+	char* Valid_;
+	unsigned long long* Ranges_;
+	unsigned long long RangeCount_;
+	unsigned char** Memory_;
+	char* Read_;
+} _EBoxPY_Capture, *_PEBoxPY_Capture;
+
+static void _EBoxPY_Capture_Free(_PEBoxPY_Capture _Capture) {
+	free(_Capture->Threads_);
+	free(_Capture->Contexts_);
+	free(_Capture->Valid_);
+	free(_Capture->Memory_);
+	free(_Capture->Read_);
+	free(_Capture->Ranges_);
+}
+
+// Runs without the GIL, the Process is only Suspended for the duration of the Reads.
+static int _EBoxPY_Capture_Run(_PEBoxPY_Capture _Capture) {
+	if (!_EBoxPY_Process_Suspend(_Capture->Process_, 0))
+		return 0;
+	int status = _EBoxPY_System_Threads(_Capture->ID_, &_Capture->Threads_, &_Capture->ThreadCount_);
+	if (status) {
+		_Capture->Contexts_ = (CONTEXT*)malloc(((size_t)_Capture->ThreadCount_ + 1) * sizeof(CONTEXT));
+		_Capture->Valid_ = (char*)calloc((size_t)_Capture->ThreadCount_ + 1, 1);
+		status = (_Capture->Contexts_ && _Capture->Valid_);
+	}
+	for (unsigned long long i = 0; status && i < _Capture->ThreadCount_; ++i) {
+		HANDLE thread = OpenThread(THREAD_GET_CONTEXT | THREAD_QUERY_LIMITED_INFORMATION, FALSE, (DWORD)_Capture->Threads_[i].ID_);
+		if (!thread)
+			continue;
+		_Capture->Contexts_[i].ContextFlags = CONTEXT_ALL;
+		_Capture->Valid_[i] = (char)(GetThreadContext(thread, &_Capture->Contexts_[i]) != FALSE);
+		CloseHandle(thread);
+	}
+	for (unsigned long long i = 0; status && i < _Capture->RangeCount_; ++i) {
+		unsigned long long address = _Capture->Ranges_[2 * i];
+		unsigned long long size = _Capture->Ranges_[2 * i + 1];
+		_Capture->Read_[i] = (char)(ReadProcessMemory(_Capture->Process_, (void*)address, _Capture->Memory_[i], (SIZE_T)size, NULL) != FALSE);
+	}
+	_EBoxPY_Process_Suspend(_Capture->Process_, 1);
+	return status;
+}
+
+static PyObject* EBoxPY_Process_CaptureState(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	PyObject* ranges = Py_None;
+	if (!PyArg_ParseTuple(args, "|O", &ranges))
+		return NULL;
+	PyObject* memory = NULL;
+	_EBoxPY_Capture capture;
+	memset(&capture, 0, sizeof(_EBoxPY_Capture));
+	capture.ID_ = self->ID_;
+	if (ranges != Py_None) {
+		PyObject* sequence = PySequence_Fast(ranges, "EBoxPY.Process.CaptureState requires _Ranges to be a sequence of (Address, Size).");
+		if (!sequence)
+			return NULL;
+		capture.RangeCount_ = (unsigned long long)PySequence_Fast_GET_SIZE(sequence);
+		capture.Ranges_ = (unsigned long long*)calloc((size_t)capture.RangeCount_ * 2 + 1, sizeof(unsigned long long));
+		capture.Memory_ = (unsigned char**)calloc((size_t)capture.RangeCount_ + 1, sizeof(unsigned char*));
+		capture.Read_ = (char*)calloc((size_t)capture.RangeCount_ + 1, 1);
+		if (!capture.Ranges_ || !capture.Memory_ || !capture.Read_) {
+			Py_DECREF(sequence);
+			_EBoxPY_Capture_Free(&capture);
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.CaptureState failed to Allocate Ranges.");
+			return NULL;
+		}
+		// The Bytes are created up front so that the Reads land in them directly.
+		memory = PyList_New((Py_ssize_t)capture.RangeCount_);
+		for (unsigned long long i = 0; memory && i < capture.RangeCount_; ++i) {
+			PyObject* bytes = NULL;
+			if (PyArg_ParseTuple(PySequence_Fast_GET_ITEM(sequence, (Py_ssize_t)i), "KK", &capture.Ranges_[2 * i], &capture.Ranges_[2 * i + 1]))
+				bytes = _EBoxPY_Create_Bytes(capture.Ranges_[2 * i + 1]);
+			if (!bytes) {
+				Py_CLEAR(memory);
+				break;
+			}
+			capture.Memory_[i] = ((PEBoxPY_Bytes)bytes)->Allocation_;
+			PyList_SET_ITEM(memory, (Py_ssize_t)i, bytes);
+		}
+		Py_DECREF(sequence);
+		if (!memory) {
+			_EBoxPY_Capture_Free(&capture);
+			return NULL;
+		}
+	}
+	else {
+		memory = PyList_New(0);
+		if (!memory)
+			return NULL;
+	}
+	// Parsing _Ranges can run Python code, the handle is only taken once the Process is pinned.
+	if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+		Py_DECREF(memory);
+		_EBoxPY_Capture_Free(&capture);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	capture.Process_ = self->Process_;
+	int status = 0;
+	Py_BEGIN_ALLOW_THREADS
+	status = _EBoxPY_Capture_Run(&capture);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Process_Unpin((PyObject*)self);
+	if (!status) {
+		Py_DECREF(memory);
+		_EBoxPY_Capture_Free(&capture);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.CaptureState failed to Suspend the Process or Query its Threads.");
+		return NULL;
+	}
+	PyObject* threads = PyList_New(0);
+	if (!threads) {
+		Py_DECREF(memory);
+		_EBoxPY_Capture_Free(&capture);
+		return NULL;
+	}
+	for (unsigned long long i = 0; i < capture.ThreadCount_; ++i) {
+		PyObject* thread = _EBoxPY_Create_Thread_ID(capture.Threads_[i].ID_);
+		if (!thread)
+			continue;
+		if (capture.Valid_[i])
+			_EBoxPY_Thread_Add_Context(((PEBoxPY_Thread)thread)->Registers_, &capture.Contexts_[i], EBOXPY_CONTEXT_ALL);
+		PyList_Append(threads, thread);
+		Py_DECREF(thread);
+	}
+	for (unsigned long long i = 0; i < capture.RangeCount_; ++i) {
+		if (!capture.Read_[i]) {
+			Py_INCREF(Py_None);
+			PyList_SetItem(memory, (Py_ssize_t)i, Py_None);
+		}
+	}
+	_EBoxPY_Capture_Free(&capture);
+	PyObject* output = PyTuple_Pack(2, threads, memory);
+	Py_DECREF(threads);
+	Py_DECREF(memory);
+	return output;
+}
+
+typedef struct _EBoxPY_Near_T {
+	unsigned long long Distance_;
+	unsigned long long Address_;
+} _EBoxPY_Near, *_PEBoxPY_Near;
+
+static int _EBoxPY_Near_Compare(const void* _Left, const void* _Right) {
+	unsigned long long left = ((const _EBoxPY_Near*)_Left)->Distance_;
+	unsigned long long right = ((const _EBoxPY_Near*)_Right)->Distance_;
+	return (left > right) - (left < right);
+}
+
+// Walks the free Regions within _Range of _Address once, then tries the closest aligned gap of each, nearest first.
+static unsigned long long _EBoxPY_Process_Allocate_Near(HANDLE _Process, unsigned long long _Address, unsigned long long _Range, unsigned long long _Size) {
+	SYSTEM_INFO information;
+	GetSystemInfo(&information);
+	unsigned long long granularity = (unsigned long long)information.dwAllocationGranularity;
+	unsigned long long minimum = (unsigned long long)information.lpMinimumApplicationAddress;
+	unsigned long long maximum = (unsigned long long)information.lpMaximumApplicationAddress;
+	unsigned long long low = (_Address > minimum + _Range ? _Address - _Range : minimum);
+	unsigned long long high = (_Address + _Range < maximum && _Address + _Range > _Address ? _Address + _Range : maximum);
+	low = (low + granularity - 1) & ~(granularity - 1);
+	if (_Size == 0 || _Size > high - low)
+		return 0;
+	// Last Address at which the whole allocation still lies within the window.
+	unsigned long long last = (high - _Size) & ~(granularity - 1);
+	_PEBoxPY_Near candidates = NULL;
+	unsigned long long count = 0;
+	unsigned long long capacity = 0;
+	MEMORY_BASIC_INFORMATION region;
+	for (unsigned long long address = low & ~(granularity - 1); address < high && VirtualQueryEx(_Process, (void*)address, &region, sizeof(MEMORY_BASIC_INFORMATION)) == sizeof(MEMORY_BASIC_INFORMATION);) {
+		unsigned long long base = (unsigned long long)region.BaseAddress;
+		unsigned long long end = base + (unsigned long long)region.RegionSize;
+		if (end <= address)
+			break;
+		address = end;
+		if (region.State != MEM_FREE || region.RegionSize < _Size)
+			continue;
+		unsigned long long first = (base + granularity - 1) & ~(granularity - 1);
+		unsigned long long final = (end - _Size) & ~(granularity - 1);
+		if (first < low)
+			first = low;
+		if (final > last)
+			final = last;
+		if (first > final || end - first < _Size)
+			continue;
+		unsigned long long best = _Address & ~(granularity - 1);
+		if (best < first)
+			best = first;
+		if (best > final)
+			best = final;
+		if (count == capacity) {
+			capacity = (capacity ? capacity * 2 : 64);
+			_PEBoxPY_Near resized = (_PEBoxPY_Near)realloc(candidates, (size_t)capacity * sizeof(_EBoxPY_Near));
+			if (!resized)
+				break;
+			candidates = resized;
+		}
+		candidates[count].Address_ = best;
+		candidates[count].Distance_ = (best > _Address ? best - _Address : _Address - best);
+		++count;
+	}
+	if (count)
+		qsort(candidates, (size_t)count, sizeof(_EBoxPY_Near), _EBoxPY_Near_Compare);
+	unsigned long long output = 0;
+	// A failure here means the gap was taken since it was queried, move on to the next closest.
+	for (unsigned long long i = 0; i < count && !output; ++i)
+		output = (unsigned long long)VirtualAllocEx(_Process, (void*)candidates[i].Address_, (SIZE_T)_Size, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+	free(candidates);
+	return output;
+}
+
+static PyObject* EBoxPY_Process_Allocate(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	Py_ssize_t length = PyTuple_Size(args);
+	if (length < 1 || length > 3){
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Allocate Takes 1-3 Arguments.");
+		return NULL;
+	}
+	PyObject* size = (PyTuple_GetItem(args, 0) == Py_None ? NULL : PyTuple_GetItem(args, 0));
+	PyObject* address = (length < 2 ? NULL : (PyTuple_GetItem(args, 1) == Py_None ? NULL : PyTuple_GetItem(args, 1)));
+	PyObject* range = (length < 3 ? NULL : (PyTuple_GetItem(args, 2) == Py_None ? NULL : PyTuple_GetItem(args, 2)));
+	if (!size || !PyLong_Check(size)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Allocate Takes int as _Size.");
+		return NULL;
+	}
+	unsigned long long _size = PyLong_AsUnsignedLongLong(size);
+	long long _address = (!address ? 0 : PyLong_AsLongLong(address));
+	long long _range = (!range ? 0 : PyLong_AsLongLong(range));
+	if (!address && range) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Allocate Invalid Arguments.");
+		return NULL;
+	}
+	else if (!address && !range) {
+		unsigned long long __address = (unsigned long long)VirtualAllocEx(self->Process_, NULL, _size, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+		if (!__address) {
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Allocate Failed to Allocate Memory.");
+			return NULL;
+		}
+		return PyLong_FromUnsignedLongLong(__address);
+	}
+	else if (address && !range) {
+		unsigned long long __address = (unsigned long long)VirtualAllocEx(self->Process_, (void*)_address, _size, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+		if (!__address) {
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Allocate Failed to Allocate Memory.");
+			return NULL;
+		}
+		return PyLong_FromUnsignedLongLong(__address);
+	}
+	else {
+		unsigned long long __address = 0;
+		if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+			return NULL;
+		}
+		Py_BEGIN_ALLOW_THREADS
+		__address = _EBoxPY_Process_Allocate_Near(self->Process_, (unsigned long long)_address, (unsigned long long)_range, _size);
+		Py_END_ALLOW_THREADS
+		_EBoxPY_Process_Unpin((PyObject*)self);
+		if (!__address) {
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Allocate Failed to Allocate Memory.");
+			return NULL;
+		}
+		return PyLong_FromUnsignedLongLong(__address);
+	}
+}
+
+static PyObject* EBoxPY_Process_Free(PEBoxPY_Process self, PyObject* allocation) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	if (!PyLong_Check(allocation)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Free requires int as _Allocation.");
+		return NULL;
+	}
+	unsigned long long address = PyLong_AsUnsignedLongLong(allocation);
+	if (!VirtualFreeEx(self->Process_, (void*)address, 0, MEM_RELEASE)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Free Failed to Free Memory.");
+		return NULL;
+	}
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Process_IsI386(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->Dump_) {
+		if (self->Dump_->Header_->Architecture_ == EBOXPY_ARCHITECTURE_I386) {
+			Py_INCREF(Py_True);
+			return Py_True;
+		}
+		else {
+			Py_INCREF(Py_False);
+			return Py_False;
+		}
+	}
+	BOOL status = FALSE;
+	if (!IsWow64Process(self->Process_, &status)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process Failed to determine if Process is Wow64.");
+		return NULL;
+	}
+	if (status) {
+		Py_INCREF(Py_True);
+		return Py_True;
+	}
+	else {
+		Py_INCREF(Py_False);
+		return Py_False;
+	}
+}
+
+static PyObject* EBoxPY_Process_IsAMD64(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->Dump_) {
+		if (self->Dump_->Header_->Architecture_ == EBOXPY_ARCHITECTURE_AMD64) {
+			Py_INCREF(Py_True);
+			return Py_True;
+		}
+		else {
+			Py_INCREF(Py_False);
+			return Py_False;
+		}
+	}
+	BOOL status = FALSE;
+	if (!IsWow64Process(self->Process_, &status)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process Failed to determine if Process is Wow64.");
+		return NULL;
+	}
+	if (status) {
+		Py_INCREF(Py_False);
+		return Py_False;
+	}
+	else {
+		Py_INCREF(Py_True);
+		return Py_True;
+	}
+}
+
+static PyObject* EBoxPY_Process_Dump(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	PyObject* path = NULL;
+	int compress = 0;
+	if (!PyArg_ParseTuple(args, "O|p", &path, &compress))
+		return NULL;
+	if (!PyUnicode_Check(path)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Dump requires _Path to be str.");
+		return NULL;
+	}
+	BOOL wow64 = FALSE;
+	if (!IsWow64Process(self->Process_, &wow64)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process Failed to determine if Process is Wow64.");
+		return NULL;
+	}
+	wchar_t* _path = PyUnicode_AsWideCharString(path, NULL);
+	if (!_path)
+		return NULL;
+	wchar_t* name = PyUnicode_AsWideCharString(self->Name_, NULL);
+	if (!name) {
+		PyMem_Free(_path);
+		return NULL;
+	}
+	int status = 0;
+	if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+		PyMem_Free(_path);
+		PyMem_Free(name);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+	status = _EBoxPY_Dump_Create(self->Process_, self->ID_, name, (wow64 ? EBOXPY_ARCHITECTURE_I386 : EBOXPY_ARCHITECTURE_AMD64), _path, (char)compress);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Process_Unpin((PyObject*)self);
+	PyMem_Free(_path);
+	PyMem_Free(name);
+	if (!status) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Dump failed to Write Dump.");
+		return NULL;
+	}
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+/*
+ *
+ * EBoxPY.Snapshot
+ *
+ */
+
+PyDoc_STRVAR(EBoxPY_Snapshot__doc__, "EBoxPY Snapshot object, a local copy of the readable memory of a Process that can be Refreshed incrementally.");
+
+#define EBOXPY_SNAPSHOT_BLOCK 0x100000
+
+typedef struct _EBoxPY_Snapshot_Region_T {
+	unsigned long long Address_;
+	unsigned long long Size_;
+	unsigned long Protection_;
+	unsigned char* Data_;
+	unsigned char* Valid_;
+} _EBoxPY_Snapshot_Region, *_PEBoxPY_Snapshot_Region;
+
+typedef struct EBoxPY_Snapshot_T {
+	//
+	PyObject_HEAD
+	//
+	PyObject* Process_;
+	//
+	unsigned long long Size_;
+	unsigned long long RegionCount_;
+	_PEBoxPY_Snapshot_Region Regions_;
+	//
+	char IsBusy_;
+	//
+} EBoxPY_Snapshot, *PEBoxPY_Snapshot;
+
+static void EBoxPY_Snapshot_dealloc(PyObject* self);
+static PyObject* EBoxPY_Snapshot_repr(PyObject* self);
+
+static PyObject* EBoxPY_Snapshot_Refresh(PEBoxPY_Snapshot self);
+static PyObject* EBoxPY_Snapshot_ReadTo(PEBoxPY_Snapshot self, PyObject* args);
+
+static PyMemberDef EBoxPY_Snapshot_Members[] = {
+	{"Process_", T_OBJECT, offsetof(EBoxPY_Snapshot, Process_), READONLY, PyDoc_STR("The Process the Snapshot was taken from.")},
+	{"Size_", T_ULONGLONG, offsetof(EBoxPY_Snapshot, Size_), READONLY, PyDoc_STR("The total Size of the memory held by the Snapshot.")},
+	{"RegionCount_", T_ULONGLONG, offsetof(EBoxPY_Snapshot, RegionCount_), READONLY, PyDoc_STR("The number of Regions held by the Snapshot.")},
+	{NULL}
+};
+
+static PyMethodDef EBoxPY_Snapshot_Methods[] = {
+	{"Refresh", (PyCFunction)EBoxPY_Snapshot_Refresh, METH_NOARGS, PyDoc_STR("EBoxPY.Snapshot.Refresh() -> [ (Address, Size), ... ]\nCopies the pages that changed since the last Refresh, returns the dirty Ranges.")},
+	{"ReadTo", (PyCFunction)EBoxPY_Snapshot_ReadTo, METH_VARARGS, PyDoc_STR("EBoxPY.Snapshot.ReadTo(_Address, _Bytes, _Start, _Size)\nReads Bytes from the Snapshot at Address into specified Bytes object.")},
+	{NULL}
+};
+
+static PyTypeObject EBoxPY_Snapshot_Type = {
+	PyObject_HEAD_INIT(NULL)
+	.tp_name = "EBoxPY.Snapshot",
+	.tp_basicsize = sizeof(EBoxPY_Snapshot),
+	.tp_doc = EBoxPY_Snapshot__doc__,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_members = EBoxPY_Snapshot_Members,
+	.tp_dealloc = EBoxPY_Snapshot_dealloc,
+	.tp_repr = EBoxPY_Snapshot_repr,
+	.tp_str = EBoxPY_Snapshot_repr,
+	.tp_methods = EBoxPY_Snapshot_Methods,
+};
+
+static int _EBoxPY_Initialize_Snapshot(PyObject* self) {
+	if (PyType_Ready(&EBoxPY_Snapshot_Type) < 0)
+		return 0;
+	PyModule_AddObject(self, "Snapshot", (PyObject*)&EBoxPY_Snapshot_Type);
+	return 1;
+}
+
+static void _EBoxPY_Snapshot_Free_Regions(_PEBoxPY_Snapshot_Region _Regions, unsigned long long _Count) {
+	for (unsigned long long i = 0; i < _Count; ++i) {
+		free(_Regions[i].Data_);
+		free(_Regions[i].Valid_);
+	}
+	free(_Regions);
+}
+
+static void _EBoxPY_Snapshot_Page(_PEBoxPY_Snapshot_Region _Region, unsigned long long _Offset, const unsigned char* _Data, unsigned long long _Size, _PEBoxPY_Ranges _Dirty) {
+	unsigned long long page = _Offset / EBOXPY_PAGE_SIZE;
+	if (!_Data) {
+		if (_Region->Valid_[page]) {
+			_Region->Valid_[page] = 0;
+			memset(_Region->Data_ + _Offset, 0, _Size);
+			_EBoxPY_Ranges_Add(_Dirty, _Region->Address_ + _Offset, _Region->Address_ + _Offset + _Size);
+		}
+		return;
+	}
+	if (_Region->Valid_[page] && memcmp(_Region->Data_ + _Offset, _Data, _Size) == 0)
+		return;
+	_Region->Valid_[page] = 1;
+	memcpy(_Region->Data_ + _Offset, _Data, _Size);
+	_EBoxPY_Ranges_Add(_Dirty, _Region->Address_ + _Offset, _Region->Address_ + _Offset + _Size);
+}
+
+// Reads the Region a block at a time and only copies the pages that differ from the held copy.
+static void _EBoxPY_Snapshot_Region_Refresh(PyObject* _Process, _PEBoxPY_Snapshot_Region _Region, unsigned char* _Scratch, _PEBoxPY_Ranges _Dirty) {
+	for (unsigned long long offset = 0; offset < _Region->Size_; offset += EBOXPY_SNAPSHOT_BLOCK) {
+		unsigned long long size = (_Region->Size_ - offset < EBOXPY_SNAPSHOT_BLOCK ? _Region->Size_ - offset : EBOXPY_SNAPSHOT_BLOCK);
+		int block = _EBoxPY_Process_Read(_Process, _Region->Address_ + offset, _Scratch, size);
+		for (unsigned long long page = 0; page < size; page += EBOXPY_PAGE_SIZE) {
+			unsigned long long length = (size - page < EBOXPY_PAGE_SIZE ? size - page : EBOXPY_PAGE_SIZE);
+			if (block || _EBoxPY_Process_Read(_Process, _Region->Address_ + offset + page, _Scratch + page, length))
+				_EBoxPY_Snapshot_Page(_Region, offset + page, _Scratch + page, length, _Dirty);
+			else
+				_EBoxPY_Snapshot_Page(_Region, offset + page, NULL, length, _Dirty);
+		}
+	}
+}
+
+/*
+ * Regions are matched against the previous Refresh by Address and Size, matching Regions that were and still are
+ * not writable are carried over without being Read again.
+ */
+static int _EBoxPY_Snapshot_Update(PEBoxPY_Snapshot _Snapshot, _PEBoxPY_Ranges _Dirty) {
+	MEMORY_BASIC_INFORMATION* information = NULL;
+	unsigned long long count = 0;
+	if (!_EBoxPY_Process_Collect_Regions(_Snapshot->Process_, &information, &count))
+		return 0;
+	_PEBoxPY_Snapshot_Region regions = (_PEBoxPY_Snapshot_Region)calloc(count + 1, sizeof(_EBoxPY_Snapshot_Region));
+	unsigned char* scratch = (unsigned char*)malloc(EBOXPY_SNAPSHOT_BLOCK);
+	if (!regions || !scratch) {
+		free(information);
+		free(regions);
+		free(scratch);
+		return 0;
+	}
+	unsigned long long length = 0;
+	unsigned long long size = 0;
+	unsigned long long j = 0;
+	int status = 1;
+	for (unsigned long long i = 0; i < count && status; ++i) {
+		if (information[i].State != MEM_COMMIT || !(information[i].Protect & EBOXPY_DUMP_READABLE) || (information[i].Protect & PAGE_GUARD))
+			continue;
+		_PEBoxPY_Snapshot_Region region = &regions[length++];
+		region->Address_ = (unsigned long long)information[i].BaseAddress;
+		region->Size_ = (unsigned long long)information[i].RegionSize;
+		region->Protection_ = (unsigned long)information[i].Protect;
+		size += region->Size_;
+		while (j < _Snapshot->RegionCount_ && _Snapshot->Regions_[j].Address_ < region->Address_)
+			++j;
+		_PEBoxPY_Snapshot_Region previous = NULL;
+		if (j < _Snapshot->RegionCount_ && _Snapshot->Regions_[j].Address_ == region->Address_ && _Snapshot->Regions_[j].Size_ == region->Size_)
+			previous = &_Snapshot->Regions_[j++];
+		if (previous) {
+			region->Data_ = previous->Data_;
+			region->Valid_ = previous->Valid_;
+			previous->Data_ = NULL;
+			previous->Valid_ = NULL;
+			if (!(region->Protection_ & EBOXPY_REGION_WRITABLE) && previous->Protection_ == region->Protection_)
+				continue;
+		}
+		else {
+			region->Data_ = (unsigned char*)malloc(region->Size_);
+			region->Valid_ = (unsigned char*)calloc((region->Size_ + EBOXPY_PAGE_SIZE - 1) / EBOXPY_PAGE_SIZE, 1);
+			if (!region->Data_ || !region->Valid_) {
+				status = 0;
+				break;
+			}
+		}
+		_EBoxPY_Snapshot_Region_Refresh(_Snapshot->Process_, region, scratch, _Dirty);
+	}
+	free(information);
+	free(scratch);
+	if (!status || _Dirty->Failed_) {
+		// Pages may have been moved out of the previous Regions, the next Refresh starts over.
+		_EBoxPY_Snapshot_Free_Regions(regions, count);
+		_EBoxPY_Snapshot_Free_Regions(_Snapshot->Regions_, _Snapshot->RegionCount_);
+		_Snapshot->Regions_ = NULL;
+		_Snapshot->RegionCount_ = 0;
+		_Snapshot->Size_ = 0;
+		return 0;
+	}
+	_EBoxPY_Snapshot_Free_Regions(_Snapshot->Regions_, _Snapshot->RegionCount_);
+	_Snapshot->Regions_ = regions;
+	_Snapshot->RegionCount_ = length;
+	_Snapshot->Size_ = size;
+	return 1;
+}
+
+static PyObject* _EBoxPY_Snapshot_Refresh(PEBoxPY_Snapshot _Snapshot) {
+	_EBoxPY_Ranges dirty = {0};
+	int status = 0;
+	if (!_EBoxPY_Process_Pin(_Snapshot->Process_)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	_Snapshot->IsBusy_ = 1;
+	Py_BEGIN_ALLOW_THREADS
+	status = _EBoxPY_Snapshot_Update(_Snapshot, &dirty);
+	Py_END_ALLOW_THREADS
+	_Snapshot->IsBusy_ = 0;
+	_EBoxPY_Process_Unpin(_Snapshot->Process_);
+	if (!status) {
+		_EBoxPY_Ranges_Free(&dirty);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Snapshot.Refresh failed to Read the Process.");
+		return NULL;
+	}
+	PyObject* output = _EBoxPY_Ranges_List(&dirty);
+	_EBoxPY_Ranges_Free(&dirty);
+	return output;
+}
+
+static PyObject* EBoxPY_Process_Snapshot(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	PyObject* output = EBoxPY_Snapshot_Type.tp_alloc(&EBoxPY_Snapshot_Type, 1);
+	if (!output)
+		return NULL;
+	EBOXPY_OBJECT_ZERO(EBoxPY_Snapshot, output);
+	PEBoxPY_Snapshot snapshot = (PEBoxPY_Snapshot)output;
+	Py_INCREF((PyObject*)self);
+	snapshot->Process_ = (PyObject*)self;
+	PyObject* dirty = _EBoxPY_Snapshot_Refresh(snapshot);
+	if (!dirty) {
+		Py_DECREF(output);
+		return NULL;
+	}
+	Py_DECREF(dirty);
+	return output;
+}
+
+static void EBoxPY_Snapshot_dealloc(PyObject* self) {
+	PEBoxPY_Snapshot snapshot = (PEBoxPY_Snapshot)self;
+	_EBoxPY_Snapshot_Free_Regions(snapshot->Regions_, snapshot->RegionCount_);
+	Py_XDECREF(snapshot->Process_);
+	Py_TYPE(self)->tp_free(self);
+}
+
+static PyObject* EBoxPY_Snapshot_repr(PyObject* self) {
+	PEBoxPY_Snapshot snapshot = (PEBoxPY_Snapshot)self;
+	char output[128];
+	sprintf(output, "<EBoxPY.Snapshot: (Regions: %llu) (Size: 0x%llx)>", snapshot->RegionCount_, snapshot->Size_);
+	return PyUnicode_FromString(output);
+}
+
+static PyObject* EBoxPY_Snapshot_Refresh(PEBoxPY_Snapshot self) {
+	if (self->IsBusy_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Snapshot is already Refreshing.");
+		return NULL;
+	}
+	return _EBoxPY_Snapshot_Refresh(self);
+}
+
+static int _EBoxPY_Snapshot_Read(PEBoxPY_Snapshot _Snapshot, unsigned long long _Address, unsigned char* _Buffer, unsigned long long _Size) {
+	unsigned long long low = 0;
+	unsigned long long high = _Snapshot->RegionCount_;
+	while (_Size) {
+		_PEBoxPY_Snapshot_Region region = NULL;
+		while (low < high) {
+			unsigned long long middle = low + (high - low) / 2;
+			if (_Address < _Snapshot->Regions_[middle].Address_)
+				high = middle;
+			else if (_Address - _Snapshot->Regions_[middle].Address_ >= _Snapshot->Regions_[middle].Size_)
+				low = middle + 1;
+			else {
+				region = &_Snapshot->Regions_[middle];
+				break;
+			}
+		}
+		if (!region)
+			return 0;
+		unsigned long long offset = _Address - region->Address_;
+		unsigned long long size = (region->Size_ - offset < _Size ? region->Size_ - offset : _Size);
+		for (unsigned long long page = offset / EBOXPY_PAGE_SIZE; page * EBOXPY_PAGE_SIZE < offset + size; ++page) {
+			if (!region->Valid_[page])
+				return 0;
+		}
+		memcpy(_Buffer, region->Data_ + offset, size);
+		_Address += size;
+		_Buffer += size;
+		_Size -= size;
+		low = 0;
+		high = _Snapshot->RegionCount_;
+	}
+	return 1;
+}
+
+static PyObject* EBoxPY_Snapshot_ReadTo(PEBoxPY_Snapshot self, PyObject* args) {
+	if (self->IsBusy_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Snapshot is already Refreshing.");
+		return NULL;
+	}
+	PyObject* bytes = NULL;
+	unsigned long long address = 0;
+	unsigned long long start = 0;
+	unsigned long long size = 0;
+	if (!PyArg_ParseTuple(args, "KOKK", &address, &bytes, &start, &size))
+		return NULL;
+	if (!PyObject_IsInstance(bytes, (PyObject*)&EBoxPY_Bytes_Type)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Snapshot.ReadTo requires _Bytes to be a Bytes object.");
+		return NULL;
+	}
+	PEBoxPY_Bytes _bytes = (PEBoxPY_Bytes)bytes;
+	if (start + size > _bytes->Size_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Snapshot.ReadTo address out of bounds.");
+		return NULL;
+	}
+	if (!_EBoxPY_Snapshot_Read(self, address, _bytes->Allocation_ + start, size)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Snapshot.ReadTo failed to Read memory.");
+		return NULL;
+	}
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+/*
+ *
+ * EBoxPY Async
+ *
+ */
+
+#define EBOXPY_ASYNC_READ 0
+#define EBOXPY_ASYNC_WRITE 1
+#define EBOXPY_ASYNC_MODULES 2
+#define EBOXPY_ASYNC_THREADS 3
+#define EBOXPY_ASYNC_REGIONS 4
+
+// A single Async request, owned by the thread pool until it completes its Future.
+typedef struct _EBoxPY_Async_T {
+	//
+	int Kind_;
+	PyObject* Process_;
+	PyObject* Loop_;
+	PyObject* Future_;
+	PyObject* Bytes_;
+	unsigned long long Address_;
+	unsigned long long Start_;
+	unsigned long long Size_;
+	//
+} _EBoxPY_Async, *_PEBoxPY_Async;
+
+static PyObject* _EBoxPY_Async_GetRunningLoop = NULL;
+static PyObject* _EBoxPY_Async_Resolve = NULL;
+
+// Runs on the event loop thread, the Future may have been cancelled in the meantime.
+static PyObject* _EBoxPY_Async_Resolve_Function(PyObject* self, PyObject* args) {
+	PyObject* future = NULL;
+	PyObject* value = NULL;
+	int failed = 0;
+	if (!PyArg_ParseTuple(args, "OOp", &future, &value, &failed))
+		return NULL;
+	PyObject* done = PyObject_CallMethod(future, "done", NULL);
+	if (!done)
+		return NULL;
+	int is_done = PyObject_IsTrue(done);
+	Py_DECREF(done);
+	if (is_done) {
+		Py_INCREF(Py_None);
+		return Py_None;
+	}
+	return PyObject_CallMethod(future, failed ? "set_exception" : "set_result", "O", value);
+}
+
+static PyMethodDef _EBoxPY_Async_Resolve_Definition = {"_Resolve", (PyCFunction)_EBoxPY_Async_Resolve_Function, METH_VARARGS, NULL};
+
+static PyObject* _EBoxPY_Async_Error(const char* _Message) {
+	return PyObject_CallFunction(PyExc_RuntimeError, "s", _Message);
+}
+
+static void CALLBACK _EBoxPY_Async_Routine(PTP_CALLBACK_INSTANCE _Instance, void* _Parameter) {
+	_PEBoxPY_Async job = (_PEBoxPY_Async)_Parameter;
+	PEBoxPY_Process process = (PEBoxPY_Process)job->Process_;
+	int status = 0;
+	MEMORY_BASIC_INFORMATION* regions = NULL;
+	char* backed = NULL;
+	unsigned long long count = 0;
+	_PEBoxPY_Module_Record modules = NULL;
+	_PEBoxPY_Thread_Record threads = NULL;
+	// Everything that Reads or Queries the Process runs here, the GIL is only taken to build the result.
+	if (job->Kind_ == EBOXPY_ASYNC_READ)
+		status = _EBoxPY_Process_Read(job->Process_, job->Address_, ((PEBoxPY_Bytes)job->Bytes_)->Allocation_ + job->Start_, job->Size_);
+	else if (job->Kind_ == EBOXPY_ASYNC_WRITE)
+		status = _EBoxPY_Process_Write(job->Process_, job->Address_, ((PEBoxPY_Bytes)job->Bytes_)->Allocation_ + job->Start_, job->Size_);
+	else if (job->Kind_ == EBOXPY_ASYNC_REGIONS)
+		status = _EBoxPY_Process_Collect_Regions_Backed(job->Process_, &regions, &backed, &count);
+	else if (job->Kind_ == EBOXPY_ASYNC_MODULES)
+		status = _EBoxPY_Process_Collect_Modules(process, &modules, &count);
+	else if (job->Kind_ == EBOXPY_ASYNC_THREADS)
+		status = (process->Dump_ ? 1 : _EBoxPY_System_Threads(process->ID_, &threads, &count));
+	if (!Py_IsInitialized())
+		return;
+	PyGILState_STATE state = PyGILState_Ensure();
+	PyObject* value = NULL;
+	int failed = 0;
+	switch (job->Kind_) {
+	case EBOXPY_ASYNC_READ:
+	case EBOXPY_ASYNC_WRITE:
+		if (status) {
+			Py_INCREF(Py_None);
+			value = Py_None;
+		}
+		else {
+			value = _EBoxPY_Async_Error(job->Kind_ == EBOXPY_ASYNC_READ ? "EBoxPY.Process.ReadToAsync failed to Read memory." : "EBoxPY.Process.WriteFromAsync failed to Write memory.");
+			failed = 1;
+		}
+		break;
+	case EBOXPY_ASYNC_MODULES:
+		if (status)
+			value = _EBoxPY_Process_Modules_Dictionary(process, modules, count);
+		else {
+			value = _EBoxPY_Async_Error("EBoxPY.Process.GetModulesAsync failed to Create Toolhelp32 Snapshot.");
+			failed = 1;
+		}
+		break;
+	case EBOXPY_ASYNC_THREADS:
+		if (process->Dump_)
+			value = _EBoxPY_Process_GetThreads_Dump(process);
+		else if (status)
+			value = _EBoxPY_Process_Threads_List(threads, count);
+		else {
+			value = _EBoxPY_Async_Error("EBoxPY.Process.GetThreadsAsync failed to Query Threads.");
+			failed = 1;
+		}
+		break;
+	case EBOXPY_ASYNC_REGIONS:
+		if (status)
+			value = _EBoxPY_Process_Regions_List(regions, backed, count);
+		else {
+			value = _EBoxPY_Async_Error("EBoxPY.Process.GetRegionsAsync failed to Query Regions.");
+			failed = 1;
+		}
+		break;
+	}
+	free(regions);
+	free(backed);
+	free(threads);
+	if (!value) {
+		// Hand the pending exception to the Future instead.
+		PyObject* type = NULL;
+		PyObject* traceback = NULL;
+		PyErr_Fetch(&type, &value, &traceback);
+		PyErr_NormalizeException(&type, &value, &traceback);
+		if (value && traceback)
+			PyException_SetTraceback(value, traceback);
+		Py_XDECREF(type);
+		Py_XDECREF(traceback);
+		if (!value)
+			value = _EBoxPY_Async_Error("EBoxPY.Process Async operation failed.");
+		failed = 1;
+	}
+	if (value) {
+		PyObject* result = PyObject_CallMethod(job->Loop_, "call_soon_threadsafe", "OOOO", _EBoxPY_Async_Resolve, job->Future_, value, failed ? Py_True : Py_False);
+		Py_XDECREF(result);
+		Py_DECREF(value);
+	}
+	// The loop may already be closed, there is nobody left to tell.
+	PyErr_Clear();
+	_EBoxPY_Process_Unpin(job->Process_);
+	Py_DECREF(job->Process_);
+	Py_DECREF(job->Loop_);
+	Py_DECREF(job->Future_);
+	Py_XDECREF(job->Bytes_);
+	free(job);
+	PyGILState_Release(state);
+}
+
+static PyObject* _EBoxPY_Async_Submit(PEBoxPY_Process self, int _Kind, PyObject* _Bytes, unsigned long long _Address, unsigned long long _Start, unsigned long long _Size) {
+	if (!_EBoxPY_Async_GetRunningLoop) {
+		PyObject* asyncio = PyImport_ImportModule("asyncio");
+		if (!asyncio)
+			return NULL;
+		_EBoxPY_Async_GetRunningLoop = PyObject_GetAttrString(asyncio, "get_running_loop");
+		Py_DECREF(asyncio);
+		if (!_EBoxPY_Async_GetRunningLoop)
+			return NULL;
+	}
+	PyObject* loop = PyObject_CallObject(_EBoxPY_Async_GetRunningLoop, NULL);
+	if (!loop)
+		return NULL;
+	PyObject* future = PyObject_CallMethod(loop, "create_future", NULL);
+	if (!future) {
+		Py_DECREF(loop);
+		return NULL;
+	}
+	// Getting the loop runs Python code, the Process is only pinned once that is done.
+	if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+		Py_DECREF(loop);
+		Py_DECREF(future);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	_PEBoxPY_Async job = (_PEBoxPY_Async)calloc(1, sizeof(_EBoxPY_Async));
+	if (!job) {
+		_EBoxPY_Process_Unpin((PyObject*)self);
+		Py_DECREF(loop);
+		Py_DECREF(future);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process failed to Allocate Async request.");
+		return NULL;
+	}
+	job->Kind_ = _Kind;
+	job->Process_ = (PyObject*)self;
+	job->Loop_ = loop;
+	job->Future_ = future;
+	job->Bytes_ = _Bytes;
+	job->Address_ = _Address;
+	job->Start_ = _Start;
+	job->Size_ = _Size;
+	Py_INCREF(job->Process_);
+	Py_INCREF(job->Future_);
+	Py_XINCREF(job->Bytes_);
+	if (!TrySubmitThreadpoolCallback(_EBoxPY_Async_Routine, job, NULL)) {
+		_EBoxPY_Process_Unpin((PyObject*)self);
+		Py_DECREF(job->Process_);
+		Py_DECREF(job->Loop_);
+		Py_DECREF(job->Future_);
+		Py_DECREF(job->Future_);
+		Py_XDECREF(job->Bytes_);
+		free(job);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process failed to Submit Async request, TrySubmitThreadpoolCallback failed.");
+		return NULL;
+	}
+	return future;
+}
+
+static int _EBoxPY_Async_Parse(PEBoxPY_Process self, PyObject* args, const char* _Name, PyObject** _Bytes, unsigned long long* _Address, unsigned long long* _Start, unsigned long long* _Size) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return 0;
+	}
+	if (!PyArg_ParseTuple(args, "KOKK", _Address, _Bytes, _Start, _Size))
+		return 0;
+	if (!PyObject_IsInstance(*_Bytes, (PyObject*)&EBoxPY_Bytes_Type)) {
+		PyErr_Format(PyExc_TypeError, "EBoxPY.Process.%s requires _Bytes to be a Bytes object.", _Name);
+		return 0;
+	}
+	if (*_Start + *_Size > ((PEBoxPY_Bytes)*_Bytes)->Size_) {
+		PyErr_Format(PyExc_RuntimeError, "EBoxPY.Process.%s address out of bounds.", _Name);
+		return 0;
+	}
+	return 1;
+}
+
+static PyObject* EBoxPY_Process_ReadToAsync(PEBoxPY_Process self, PyObject* args) {
+	PyObject* bytes = NULL;
+	unsigned long long address = 0;
+	unsigned long long start = 0;
+	unsigned long long size = 0;
+	if (!_EBoxPY_Async_Parse(self, args, "ReadToAsync", &bytes, &address, &start, &size))
+		return NULL;
+	return _EBoxPY_Async_Submit(self, EBOXPY_ASYNC_READ, bytes, address, start, size);
+}
+
+static PyObject* EBoxPY_Process_WriteFromAsync(PEBoxPY_Process self, PyObject* args) {
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	PyObject* bytes = NULL;
+	unsigned long long address = 0;
+	unsigned long long start = 0;
+	unsigned long long size = 0;
+	if (!_EBoxPY_Async_Parse(self, args, "WriteFromAsync", &bytes, &address, &start, &size))
+		return NULL;
+	return _EBoxPY_Async_Submit(self, EBOXPY_ASYNC_WRITE, bytes, address, start, size);
+}
+
+static PyObject* EBoxPY_Process_GetModulesAsync(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	return _EBoxPY_Async_Submit(self, EBOXPY_ASYNC_MODULES, NULL, 0, 0, 0);
+}
+
+static PyObject* EBoxPY_Process_GetThreadsAsync(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	return _EBoxPY_Async_Submit(self, EBOXPY_ASYNC_THREADS, NULL, 0, 0, 0);
+}
+
+static PyObject* EBoxPY_Process_GetRegionsAsync(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	return _EBoxPY_Async_Submit(self, EBOXPY_ASYNC_REGIONS, NULL, 0, 0, 0);
+}
+
+static int _EBoxPY_Initialize_Async(PyObject* self) {
+	_EBoxPY_Async_Resolve = PyCFunction_New(&_EBoxPY_Async_Resolve_Definition, NULL);
+	if (!_EBoxPY_Async_Resolve)
+		return 0;
+	return 1;
+}
+
+/*
+ *
+ * EBoxPY.Watch
+ *
+ */
+
+PyDoc_STRVAR(EBoxPY_Watch__doc__, "EBoxPY Watch object, samples a set of locations in a Process at a fixed rate on a native Thread.\nEach record is a UINT64 timestamp in nanoseconds since the Watch started, the values packed at their Native sizes, then a validity bitmap with one bit per location, see Format_.");
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+#define EBOXPY_WATCH_SPAN_GAP 64
+
+typedef struct _EBoxPY_Watch_Entry_T {
+	unsigned long long Address_;
+	unsigned long long* Offsets_;
+	unsigned long long OffsetCount_;
+	unsigned long long Size_;
+	unsigned long long RecordOffset_;
+	unsigned long long Index_;
+} _EBoxPY_Watch_Entry, *_PEBoxPY_Watch_Entry;
+
+// A run of direct entries close enough together to be Read with one call.
+typedef struct _EBoxPY_Watch_Span_T {
+	unsigned long long Address_;
+	unsigned long long Size_;
+	unsigned long long First_;
+	unsigned long long Count_;
+} _EBoxPY_Watch_Span, *_PEBoxPY_Watch_Span;
+
+typedef struct EBoxPY_Watch_T {
+	//
+	PyObject_HEAD
+	//
+	PyObject* Process_;
+	PyObject* Format_;
+	double Hz_;
+	unsigned long long Count_;
+	unsigned long long RecordSize_;
+	unsigned long long Capacity_;
+	volatile LONG64 Overruns_;
+	char IsRunning_;
+	//
+	HANDLE Handle_;
+	HANDLE Thread_;
+	HANDLE Stop_;
+	HANDLE Timer_;
+	unsigned long long PointerSize_;
+	_PEBoxPY_Watch_Entry Entries_;
+	_PEBoxPY_Watch_Span Spans_;
+	unsigned long long SpanCount_;
+	unsigned char* Scratch_;
+	_EBoxPY_Ring Ring_;
+	//
+} EBoxPY_Watch, *PEBoxPY_Watch;
+
+static void EBoxPY_Watch_dealloc(PyObject* self);
+static PyObject* EBoxPY_Watch_repr(PyObject* self);
+
+static PyObject* EBoxPY_Watch_Drain(PEBoxPY_Watch self, PyObject* args);
+static PyObject* EBoxPY_Watch_Stop(PEBoxPY_Watch self);
+
+static PyMemberDef EBoxPY_Watch_Members[] = {
+	{"Process_", T_OBJECT, offsetof(EBoxPY_Watch, Process_), READONLY, PyDoc_STR("The Process being sampled.")},
+	{"Format_", T_OBJECT, offsetof(EBoxPY_Watch, Format_), READONLY, PyDoc_STR("The struct module format of a single record.")},
+	{"Hz_", T_DOUBLE, offsetof(EBoxPY_Watch, Hz_), READONLY, PyDoc_STR("The sampling rate.")},
+	{"Count_", T_ULONGLONG, offsetof(EBoxPY_Watch, Count_), READONLY, PyDoc_STR("The number of locations sampled per record.")},
+	{"RecordSize_", T_ULONGLONG, offsetof(EBoxPY_Watch, RecordSize_), READONLY, PyDoc_STR("The Size of a single record.")},
+	{"Capacity_", T_ULONGLONG, offsetof(EBoxPY_Watch, Capacity_), READONLY, PyDoc_STR("The number of records buffered before samples are Dropped.")},
+	{"Dropped_", T_LONGLONG, offsetof(EBoxPY_Watch, Ring_) + offsetof(_EBoxPY_Ring, Dropped_), READONLY, PyDoc_STR("The number of records Dropped because the buffer was full.")},
+	{"Overruns_", T_LONGLONG, offsetof(EBoxPY_Watch, Overruns_), READONLY, PyDoc_STR("The number of sample periods skipped because sampling fell behind.")},
+	{"IsRunning_", T_BOOL, offsetof(EBoxPY_Watch, IsRunning_), READONLY, PyDoc_STR("True until the Watch is Stopped.")},
+	{NULL}
+};
+
+static PyMethodDef EBoxPY_Watch_Methods[] = {
+	{"Drain", (PyCFunction)EBoxPY_Watch_Drain, METH_VARARGS, PyDoc_STR("EBoxPY.Watch.Drain(_Maximum=0) -> bytes\nRemoves up to _Maximum buffered records, or every buffered record when 0, suitable for numpy.frombuffer.")},
+	{"Stop", (PyCFunction)EBoxPY_Watch_Stop, METH_NOARGS, PyDoc_STR("EBoxPY.Watch.Stop()\nStops sampling, buffered records remain Drainable.")},
+	{NULL}
+};
+
+static PyTypeObject EBoxPY_Watch_Type = {
+	PyObject_HEAD_INIT(NULL)
+	.tp_name = "EBoxPY.Watch",
+	.tp_basicsize = sizeof(EBoxPY_Watch),
+	.tp_doc = EBoxPY_Watch__doc__,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_members = EBoxPY_Watch_Members,
+	.tp_dealloc = EBoxPY_Watch_dealloc,
+	.tp_repr = EBoxPY_Watch_repr,
+	.tp_str = EBoxPY_Watch_repr,
+	.tp_methods = EBoxPY_Watch_Methods,
+};
+
+static int _EBoxPY_Initialize_Watch(PyObject* self) {
+	if (PyType_Ready(&EBoxPY_Watch_Type) < 0)
+		return 0;
+	PyModule_AddObject(self, "Watch", (PyObject*)&EBoxPY_Watch_Type);
+	return 1;
+}
+
+static const char _EBoxPY_Watch_Codes[] = "BbHhIiQqfd";
+
+static int _EBoxPY_Watch_Entry_Compare(const void* _Left, const void* _Right) {
+	unsigned long long left = ((const _EBoxPY_Watch_Entry*)_Left)->Address_;
+	unsigned long long right = ((const _EBoxPY_Watch_Entry*)_Right)->Address_;
+	return (left > right) - (left < right);
+}
+
+static int _EBoxPY_Watch_Resolve(PEBoxPY_Watch _Watch, _PEBoxPY_Watch_Entry _Entry, unsigned long long* _Address) {
+	unsigned long long address = _Entry->Address_;
+	for (unsigned long long i = 0; i < _Entry->OffsetCount_; ++i) {
+		unsigned long long pointer = 0;
+		if (!ReadProcessMemory(_Watch->Handle_, (void*)address, &pointer, (SIZE_T)_Watch->PointerSize_, NULL))
+			return 0;
+		address = pointer + _Entry->Offsets_[i];
+	}
+	*_Address = address;
+	return 1;
+}
+
+static void _EBoxPY_Watch_Sample(PEBoxPY_Watch _Watch, unsigned char* _Record) {
+	unsigned char* valid = _Record + _Watch->RecordSize_ - (_Watch->Count_ + 7) / 8;
+	memset(valid, 0, (_Watch->Count_ + 7) / 8);
+	unsigned long long index = 0;
+	for (unsigned long long i = 0; i < _Watch->SpanCount_; ++i) {
+		_PEBoxPY_Watch_Span span = &_Watch->Spans_[i];
+		int status = ReadProcessMemory(_Watch->Handle_, (void*)span->Address_, _Watch->Scratch_, (SIZE_T)span->Size_, NULL);
+		for (unsigned long long j = span->First_; j < span->First_ + span->Count_; ++j) {
+			_PEBoxPY_Watch_Entry entry = &_Watch->Entries_[j];
+			unsigned char* value = _Record + entry->RecordOffset_;
+			// A span straddling an unreadable page fails as a whole, retry its entries one by one.
+			if (status)
+				memcpy(value, _Watch->Scratch_ + (entry->Address_ - span->Address_), entry->Size_);
+			else if (!ReadProcessMemory(_Watch->Handle_, (void*)entry->Address_, value, (SIZE_T)entry->Size_, NULL)) {
+				memset(value, 0, entry->Size_);
+				continue;
+			}
+			valid[entry->Index_ / 8] |= (unsigned char)(1u << (entry->Index_ % 8));
+		}
+		index = span->First_ + span->Count_;
+	}
+	for (; index < _Watch->Count_; ++index) {
+		_PEBoxPY_Watch_Entry entry = &_Watch->Entries_[index];
+		unsigned char* value = _Record + entry->RecordOffset_;
+		unsigned long long address = 0;
+		if (!_EBoxPY_Watch_Resolve(_Watch, entry, &address) || !ReadProcessMemory(_Watch->Handle_, (void*)address, value, (SIZE_T)entry->Size_, NULL)) {
+			memset(value, 0, entry->Size_);
+			continue;
+		}
+		valid[entry->Index_ / 8] |= (unsigned char)(1u << (entry->Index_ % 8));
+	}
+}
+
+static DWORD WINAPI _EBoxPY_Watch_Routine(LPVOID _Parameter) {
+	PEBoxPY_Watch watch = (PEBoxPY_Watch)_Parameter;
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER start;
+	LARGE_INTEGER now;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&start);
+	double interval = (double)frequency.QuadPart / watch->Hz_;
+	unsigned long long tick = 0;
+	HANDLE handles[2] = { watch->Stop_, watch->Timer_ };
+	for (;;) {
+		QueryPerformanceCounter(&now);
+		unsigned char* record = _EBoxPY_Ring_Reserve(&watch->Ring_);
+		if (record) {
+			*(unsigned long long*)record = (unsigned long long)((double)(now.QuadPart - start.QuadPart) * 1000000000.0 / (double)frequency.QuadPart);
+			_EBoxPY_Watch_Sample(watch, record);
+			_EBoxPY_Ring_Commit(&watch->Ring_);
+		}
+		++tick;
+		QueryPerformanceCounter(&now);
+		long long deadline = start.QuadPart + (long long)((double)tick * interval);
+		if (now.QuadPart >= deadline) {
+			// Behind schedule, skip the missed periods rather than bursting to catch up.
+			unsigned long long behind = (unsigned long long)((double)(now.QuadPart - start.QuadPart) / interval) + 1;
+			InterlockedExchangeAdd64(&watch->Overruns_, (LONG64)(behind - tick));
+			tick = behind;
+			deadline = start.QuadPart + (long long)((double)tick * interval);
+		}
+		LARGE_INTEGER due;
+		due.QuadPart = -(long long)((double)(deadline - now.QuadPart) * 10000000.0 / (double)frequency.QuadPart);
+		if (due.QuadPart > -1)
+			due.QuadPart = -1;
+		SetWaitableTimer(watch->Timer_, &due, 0, NULL, NULL, FALSE);
+		if (WaitForMultipleObjects(2, handles, FALSE, INFINITE) != WAIT_OBJECT_0 + 1)
+			break;
+	}
+	return 0;
+}
+
+static void _EBoxPY_Watch_Stop(PEBoxPY_Watch _Watch) {
+	if (!_Watch->Thread_)
+		return;
+	SetEvent(_Watch->Stop_);
+	Py_BEGIN_ALLOW_THREADS
+	WaitForSingleObject(_Watch->Thread_, INFINITE);
+	Py_END_ALLOW_THREADS
+	CloseHandle(_Watch->Thread_);
+	_Watch->Thread_ = NULL;
+	_Watch->IsRunning_ = 0;
+}
+
+static void EBoxPY_Watch_dealloc(PyObject* self) {
+	PEBoxPY_Watch watch = (PEBoxPY_Watch)self;
+	_EBoxPY_Watch_Stop(watch);
+	if (watch->Timer_)
+		CloseHandle(watch->Timer_);
+	if (watch->Stop_)
+		CloseHandle(watch->Stop_);
+	if (watch->Handle_)
+		CloseHandle(watch->Handle_);
+	if (watch->Entries_) {
+		for (unsigned long long i = 0; i < watch->Count_; ++i)
+			free(watch->Entries_[i].Offsets_);
+		free(watch->Entries_);
+	}
+	free(watch->Spans_);
+	free(watch->Scratch_);
+	_EBoxPY_Ring_Free(&watch->Ring_);
+	Py_XDECREF(watch->Process_);
+	Py_XDECREF(watch->Format_);
+	Py_TYPE(self)->tp_free(self);
+}
+
+static PyObject* EBoxPY_Watch_repr(PyObject* self) {
+	PEBoxPY_Watch watch = (PEBoxPY_Watch)self;
+	char buffer[128] = {0};
+	sprintf(buffer, "<EBoxPY.Watch: (Count: %llu) (Hz: %.1f) (IsRunning: %i)>", watch->Count_, watch->Hz_, (int)watch->IsRunning_);
+	return PyUnicode_FromString(buffer);
+}
+
+static PyObject* EBoxPY_Watch_Drain(PEBoxPY_Watch self, PyObject* args) {
+	unsigned long long maximum = 0;
+	if (!PyArg_ParseTuple(args, "|K", &maximum))
+		return NULL;
+	unsigned long long count = _EBoxPY_Ring_Available(&self->Ring_);
+	if (maximum && count > maximum)
+		count = maximum;
+	PyObject* output = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)(count * self->RecordSize_));
+	if (!output)
+		return NULL;
+	_EBoxPY_Ring_Drain(&self->Ring_, (unsigned char*)PyBytes_AS_STRING(output), count);
+	return output;
+}
+
+static PyObject* EBoxPY_Watch_Stop(PEBoxPY_Watch self) {
+	_EBoxPY_Watch_Stop(self);
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+// _Location is either an int Address or a sequence (Base, Offset, ...) Read as a pointer path.
+static int _EBoxPY_Watch_Parse_Location(PyObject* _Location, _PEBoxPY_Watch_Entry _Entry) {
+	if (PyLong_Check(_Location)) {
+		_Entry->Address_ = PyLong_AsUnsignedLongLong(_Location);
+		return !PyErr_Occurred();
+	}
+	PyObject* path = PySequence_Fast(_Location, "EBoxPY.Process.Watch requires each location to be an int or a sequence of ints.");
+	if (!path)
+		return 0;
+	Py_ssize_t length = PySequence_Fast_GET_SIZE(path);
+	if (length < 1) {
+		Py_DECREF(path);
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Watch requires pointer paths to contain a Base Address.");
+		return 0;
+	}
+	_Entry->OffsetCount_ = (unsigned long long)(length - 1);
+	_Entry->Offsets_ = (unsigned long long*)calloc((size_t)length, sizeof(unsigned long long));
+	if (!_Entry->Offsets_) {
+		Py_DECREF(path);
+		PyErr_NoMemory();
+		return 0;
+	}
+	_Entry->Address_ = PyLong_AsUnsignedLongLong(PySequence_Fast_GET_ITEM(path, 0));
+	for (Py_ssize_t i = 1; i < length && !PyErr_Occurred(); ++i)
+		_Entry->Offsets_[i - 1] = (unsigned long long)PyLong_AsLongLong(PySequence_Fast_GET_ITEM(path, i));
+	Py_DECREF(path);
+	return !PyErr_Occurred();
+}
+
+static int _EBoxPY_Watch_Build(PEBoxPY_Watch _Watch, PyObject* _Locations, PyObject* _Types) {
+	PyObject* locations = PySequence_Fast(_Locations, "EBoxPY.Process.Watch requires _Locations to be a sequence.");
+	if (!locations)
+		return 0;
+	PyObject* types = NULL;
+	if (!PyLong_Check(_Types)) {
+		types = PySequence_Fast(_Types, "EBoxPY.Process.Watch requires _Types to be an int or a sequence of ints.");
+		if (!types) {
+			Py_DECREF(locations);
+			return 0;
+		}
+		if (PySequence_Fast_GET_SIZE(types) != PySequence_Fast_GET_SIZE(locations)) {
+			PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Watch requires one _Type per location.");
+			Py_DECREF(locations);
+			Py_DECREF(types);
+			return 0;
+		}
+	}
+	_Watch->Count_ = (unsigned long long)PySequence_Fast_GET_SIZE(locations);
+	_Watch->Entries_ = (_PEBoxPY_Watch_Entry)calloc((size_t)_Watch->Count_ + 1, sizeof(_EBoxPY_Watch_Entry));
+	PyObject* format = PyUnicode_FromString("<Q");
+	int status = (_Watch->Entries_ && format);
+	unsigned long long offset = sizeof(unsigned long long);
+	for (unsigned long long i = 0; status && i < _Watch->Count_; ++i) {
+		_PEBoxPY_Watch_Entry entry = &_Watch->Entries_[i];
+		unsigned long long type = PyLong_AsUnsignedLongLong(types ? PySequence_Fast_GET_ITEM(types, (Py_ssize_t)i) : _Types);
+		entry->Size_ = (PyErr_Occurred() ? 0 : _EBoxPY_GetNativeSize(type));
+		if (!entry->Size_) {
+			PyErr_Clear();
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Watch requires a valid _Type.");
+			status = 0;
+			break;
+		}
+		if (!_EBoxPY_Watch_Parse_Location(PySequence_Fast_GET_ITEM(locations, (Py_ssize_t)i), entry)) {
+			status = 0;
+			break;
+		}
+		entry->Index_ = i;
+		entry->RecordOffset_ = offset;
+		offset += entry->Size_;
+		PyObject* code = PyUnicode_FromStringAndSize(&_EBoxPY_Watch_Codes[type], 1);
+		PyUnicode_Append(&format, code);
+		Py_XDECREF(code);
+		status = (format != NULL);
+	}
+	Py_DECREF(locations);
+	Py_XDECREF(types);
+	if (!status) {
+		Py_XDECREF(format);
+		if (!PyErr_Occurred())
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Watch failed to Allocate locations.");
+		return 0;
+	}
+	PyObject* bitmap = PyUnicode_FromFormat("%llus", (_Watch->Count_ + 7) / 8);
+	PyUnicode_Append(&format, bitmap);
+	Py_XDECREF(bitmap);
+	if (!format)
+		return 0;
+	_Watch->Format_ = format;
+	_Watch->RecordSize_ = offset + (_Watch->Count_ + 7) / 8;
+	// Direct entries first, in Address order, so that neighbours can share a span.
+	unsigned long long direct = 0;
+	for (unsigned long long i = 0; i < _Watch->Count_; ++i) {
+		if (!_Watch->Entries_[i].OffsetCount_) {
+			_EBoxPY_Watch_Entry entry = _Watch->Entries_[direct];
+			_Watch->Entries_[direct] = _Watch->Entries_[i];
+			_Watch->Entries_[i] = entry;
+			++direct;
+		}
+	}
+	qsort(_Watch->Entries_, (size_t)direct, sizeof(_EBoxPY_Watch_Entry), _EBoxPY_Watch_Entry_Compare);
+	_Watch->Spans_ = (_PEBoxPY_Watch_Span)calloc((size_t)direct + 1, sizeof(_EBoxPY_Watch_Span));
+	if (!_Watch->Spans_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Watch failed to Allocate spans.");
+		return 0;
+	}
+	unsigned long long scratch = 0;
+	for (unsigned long long i = 0; i < direct; ++i) {
+		_PEBoxPY_Watch_Entry entry = &_Watch->Entries_[i];
+		_PEBoxPY_Watch_Span span = (_Watch->SpanCount_ ? &_Watch->Spans_[_Watch->SpanCount_ - 1] : NULL);
+		unsigned long long end = entry->Address_ + entry->Size_;
+		if (span && entry->Address_ <= span->Address_ + span->Size_ + EBOXPY_WATCH_SPAN_GAP && end - span->Address_ <= EBOXPY_PAGE_SIZE) {
+			if (end > span->Address_ + span->Size_)
+				span->Size_ = end - span->Address_;
+			++span->Count_;
+		}
+		else {
+			span = &_Watch->Spans_[_Watch->SpanCount_++];
+			span->Address_ = entry->Address_;
+			span->Size_ = entry->Size_;
+			span->First_ = i;
+			span->Count_ = 1;
+		}
+		if (span->Size_ > scratch)
+			scratch = span->Size_;
+	}
+	_Watch->Scratch_ = (unsigned char*)malloc((size_t)scratch + 1);
+	if (!_Watch->Scratch_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Watch failed to Allocate scratch.");
+		return 0;
+	}
+	return 1;
+}
+
+static PyObject* EBoxPY_Process_Watch(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	PyObject* locations = NULL;
+	PyObject* types = NULL;
+	double hz = 0.0;
+	if (!PyArg_ParseTuple(args, "OOd", &locations, &types, &hz))
+		return NULL;
+	if (!(hz > 0.0) || hz > 1000000.0) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Watch requires 0 < _Hz <= 1000000.");
+		return NULL;
+	}
+	PyObject* output = EBoxPY_Watch_Type.tp_alloc(&EBoxPY_Watch_Type, 1);
+	if (!output)
+		return NULL;
+	EBOXPY_OBJECT_ZERO(EBoxPY_Watch, output);
+	PEBoxPY_Watch watch = (PEBoxPY_Watch)output;
+	Py_INCREF((PyObject*)self);
+	watch->Process_ = (PyObject*)self;
+	watch->Hz_ = hz;
+	if (!_EBoxPY_Watch_Build(watch, locations, types)) {
+		Py_DECREF(output);
+		return NULL;
+	}
+	BOOL wow64 = FALSE;
+	IsWow64Process(self->Process_, &wow64);
+	watch->PointerSize_ = (wow64 ? 4 : 8);
+	// Roughly four seconds of records before the consumer has to Drain.
+	watch->Capacity_ = (unsigned long long)(hz * 4.0);
+	if (watch->Capacity_ < 1024)
+		watch->Capacity_ = 1024;
+	if (!_EBoxPY_Ring_Create(&watch->Ring_, watch->RecordSize_, watch->Capacity_)) {
+		Py_DECREF(output);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Watch failed to Allocate the record buffer.");
+		return NULL;
+	}
+	watch->Capacity_ = watch->Ring_.Capacity_;
+	// The Watch keeps its own Handle, so Closing the Process does not pull it out from under the sampling Thread.
+	if (!DuplicateHandle(GetCurrentProcess(), self->Process_, GetCurrentProcess(), &watch->Handle_, 0, FALSE, DUPLICATE_SAME_ACCESS)) {
+		watch->Handle_ = NULL;
+		Py_DECREF(output);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Watch failed to Duplicate the Process Handle.");
+		return NULL;
+	}
+	watch->Stop_ = CreateEventW(NULL, TRUE, FALSE, NULL);
+	watch->Timer_ = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	if (!watch->Timer_)
+		watch->Timer_ = CreateWaitableTimerExW(NULL, NULL, 0, TIMER_ALL_ACCESS);
+	if (!watch->Stop_ || !watch->Timer_) {
+		Py_DECREF(output);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Watch failed to Create the Timer.");
+		return NULL;
+	}
+	watch->Thread_ = CreateThread(NULL, 0, _EBoxPY_Watch_Routine, watch, 0, NULL);
+	if (!watch->Thread_) {
+		Py_DECREF(output);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Watch failed to Create the sampling Thread.");
+		return NULL;
+	}
+	SetThreadPriority(watch->Thread_, THREAD_PRIORITY_HIGHEST);
+	watch->IsRunning_ = 1;
+	return output;
+}
+
+/*
+ *
+ * EBoxPY Freeze
+ *
+ */
+
+// The finest waitable timer resolution in microseconds, a shorter _Interval would only spin the freeze Thread.
+#define EBOXPY_FREEZE_MINIMUM 500
+
+typedef struct _EBoxPY_Freeze_Entry_T {
+	unsigned long long Handle_;
+	unsigned long long Address_;
+	unsigned long long Size_;
+	unsigned char Value_[8];
+	long long Interval_;
+	long long Next_;
+	unsigned long long Writes_;
+	unsigned long long Failures_;
+	unsigned long LastError_;
+} _EBoxPY_Freeze_Entry, *_PEBoxPY_Freeze_Entry;
+
+// One Thread per Process rewrites every frozen value, Entries_ is kept in Handle order.
+typedef struct _EBoxPY_Freezer_T {
+	CRITICAL_SECTION Lock_;
+	HANDLE Handle_;
+	HANDLE Thread_;
+	HANDLE Stop_;
+	HANDLE Wake_;
+	HANDLE Timer_;
+	_PEBoxPY_Freeze_Entry Entries_;
+	unsigned long long Count_;
+	unsigned long long Capacity_;
+	unsigned long long NextHandle_;
+} _EBoxPY_Freezer, *_PEBoxPY_Freezer;
+
+static _PEBoxPY_Freeze_Entry _EBoxPY_Freezer_Find(_PEBoxPY_Freezer _Freezer, unsigned long long _Handle) {
+	unsigned long long low = 0;
+	unsigned long long high = _Freezer->Count_;
+	while (low < high) {
+		unsigned long long middle = low + (high - low) / 2;
+		if (_Freezer->Entries_[middle].Handle_ < _Handle)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	if (low < _Freezer->Count_ && _Freezer->Entries_[low].Handle_ == _Handle)
+		return &_Freezer->Entries_[low];
+	return NULL;
+}
+
+static int _EBoxPY_Freeze_Entry_Compare(const void* _Left, const void* _Right) {
+	unsigned long long left = ((const _EBoxPY_Freeze_Entry*)_Left)->Address_;
+	unsigned long long right = ((const _EBoxPY_Freeze_Entry*)_Right)->Address_;
+	return (left > right) - (left < right);
+}
+
+// Writes the due entries in _Work, merging byte-contiguous neighbours on the same page into a single Write.
+static void _EBoxPY_Freezer_Write(_PEBoxPY_Freezer _Freezer, _PEBoxPY_Freeze_Entry _Work, unsigned long long _Count) {
+	unsigned char buffer[EBOXPY_PAGE_SIZE];
+	qsort(_Work, (size_t)_Count, sizeof(_EBoxPY_Freeze_Entry), _EBoxPY_Freeze_Entry_Compare);
+	for (unsigned long long i = 0; i < _Count;) {
+		unsigned long long start = _Work[i].Address_;
+		unsigned long long end = start;
+		unsigned long long j = i;
+		for (; j < _Count && _Work[j].Address_ == end && (_Work[j].Address_ + _Work[j].Size_ - 1) / EBOXPY_PAGE_SIZE == start / EBOXPY_PAGE_SIZE; ++j) {
+			memcpy(buffer + (end - start), _Work[j].Value_, _Work[j].Size_);
+			end += _Work[j].Size_;
+		}
+		if (j == i) {
+			// Overlapping or page straddling entry, Written on its own.
+			memcpy(buffer, _Work[i].Value_, _Work[i].Size_);
+			end = start + _Work[i].Size_;
+			j = i + 1;
+		}
+		if (WriteProcessMemory(_Freezer->Handle_, (void*)start, buffer, (SIZE_T)(end - start), NULL)) {
+			for (unsigned long long k = i; k < j; ++k) {
+				_Work[k].Writes_ = 1;
+				_Work[k].LastError_ = 0;
+			}
+		}
+		else {
+			// Retry one by one so that the failure is attributed to the right entries.
+			for (unsigned long long k = i; k < j; ++k) {
+				if (j - i > 1 && WriteProcessMemory(_Freezer->Handle_, (void*)_Work[k].Address_, _Work[k].Value_, (SIZE_T)_Work[k].Size_, NULL)) {
+					_Work[k].Writes_ = 1;
+					_Work[k].LastError_ = 0;
+				}
+				else {
+					_Work[k].Failures_ = 1;
+					_Work[k].LastError_ = GetLastError();
+				}
+			}
+		}
+		i = j;
+	}
+}
+
+static DWORD WINAPI _EBoxPY_Freezer_Routine(LPVOID _Parameter) {
+	_PEBoxPY_Freezer freezer = (_PEBoxPY_Freezer)_Parameter;
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER now;
+	QueryPerformanceFrequency(&frequency);
+	HANDLE handles[3] = { freezer->Stop_, freezer->Wake_, freezer->Timer_ };
+	_PEBoxPY_Freeze_Entry work = NULL;
+	unsigned long long capacity = 0;
+	for (;;) {
+		unsigned long long count = 0;
+		long long next = 0;
+		EnterCriticalSection(&freezer->Lock_);
+		QueryPerformanceCounter(&now);
+		if (capacity < freezer->Count_) {
+			_PEBoxPY_Freeze_Entry resized = (_PEBoxPY_Freeze_Entry)realloc(work, (size_t)freezer->Count_ * sizeof(_EBoxPY_Freeze_Entry));
+			if (resized) {
+				work = resized;
+				capacity = freezer->Count_;
+			}
+		}
+		for (unsigned long long i = 0; i < freezer->Count_; ++i) {
+			_PEBoxPY_Freeze_Entry entry = &freezer->Entries_[i];
+			if (entry->Next_ <= now.QuadPart && count < capacity) {
+				work[count] = *entry;
+				work[count].Writes_ = 0;
+				work[count].Failures_ = 0;
+				++count;
+				entry->Next_ += entry->Interval_;
+				if (entry->Next_ <= now.QuadPart)
+					entry->Next_ = now.QuadPart + entry->Interval_;
+			}
+			if (!next || entry->Next_ < next)
+				next = entry->Next_;
+		}
+		LeaveCriticalSection(&freezer->Lock_);
+		if (count) {
+			_EBoxPY_Freezer_Write(freezer, work, count);
+			EnterCriticalSection(&freezer->Lock_);
+			for (unsigned long long i = 0; i < count; ++i) {
+				_PEBoxPY_Freeze_Entry entry = _EBoxPY_Freezer_Find(freezer, work[i].Handle_);
+				if (!entry)
+					continue;
+				entry->Writes_ += work[i].Writes_;
+				entry->Failures_ += work[i].Failures_;
+				entry->LastError_ = work[i].LastError_;
+			}
+			LeaveCriticalSection(&freezer->Lock_);
+		}
+		DWORD result = 0;
+		if (next) {
+			QueryPerformanceCounter(&now);
+			LARGE_INTEGER due;
+			due.QuadPart = -(long long)((double)(next - now.QuadPart) * 10000000.0 / (double)frequency.QuadPart);
+			if (due.QuadPart > -1)
+				due.QuadPart = -1;
+			SetWaitableTimer(freezer->Timer_, &due, 0, NULL, NULL, FALSE);
+			result = WaitForMultipleObjects(3, handles, FALSE, INFINITE);
+		}
+		else {
+			result = WaitForMultipleObjects(2, handles, FALSE, INFINITE);
+		}
+		if (result == WAIT_OBJECT_0 || result == WAIT_FAILED)
+			break;
+	}
+	free(work);
+	return 0;
+}
+
+static void _EBoxPY_Freezer_Destroy(_PEBoxPY_Freezer _Freezer) {
+	if (!_Freezer)
+		return;
+	if (_Freezer->Thread_) {
+		SetEvent(_Freezer->Stop_);
+		Py_BEGIN_ALLOW_THREADS
+		WaitForSingleObject(_Freezer->Thread_, INFINITE);
+		Py_END_ALLOW_THREADS
+		CloseHandle(_Freezer->Thread_);
+	}
+	if (_Freezer->Timer_)
+		CloseHandle(_Freezer->Timer_);
+	if (_Freezer->Wake_)
+		CloseHandle(_Freezer->Wake_);
+	if (_Freezer->Stop_)
+		CloseHandle(_Freezer->Stop_);
+	if (_Freezer->Handle_)
+		CloseHandle(_Freezer->Handle_);
+	DeleteCriticalSection(&_Freezer->Lock_);
+	free(_Freezer->Entries_);
+	free(_Freezer);
+}
+
+static _PEBoxPY_Freezer _EBoxPY_Freezer_Create(PEBoxPY_Process _Process) {
+	_PEBoxPY_Freezer freezer = (_PEBoxPY_Freezer)calloc(1, sizeof(_EBoxPY_Freezer));
+	if (!freezer)
+		return NULL;
+	InitializeCriticalSection(&freezer->Lock_);
+	freezer->NextHandle_ = 1;
+	if (!DuplicateHandle(GetCurrentProcess(), _Process->Process_, GetCurrentProcess(), &freezer->Handle_, 0, FALSE, DUPLICATE_SAME_ACCESS))
+		freezer->Handle_ = NULL;
+	freezer->Stop_ = CreateEventW(NULL, TRUE, FALSE, NULL);
+	freezer->Wake_ = CreateEventW(NULL, FALSE, FALSE, NULL);
+	freezer->Timer_ = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	if (!freezer->Timer_)
+		freezer->Timer_ = CreateWaitableTimerExW(NULL, NULL, 0, TIMER_ALL_ACCESS);
+	if (freezer->Handle_ && freezer->Stop_ && freezer->Wake_ && freezer->Timer_)
+		freezer->Thread_ = CreateThread(NULL, 0, _EBoxPY_Freezer_Routine, freezer, 0, NULL);
+	if (!freezer->Thread_) {
+		_EBoxPY_Freezer_Destroy(freezer);
+		return NULL;
+	}
+	SetThreadPriority(freezer->Thread_, THREAD_PRIORITY_HIGHEST);
+	return freezer;
+}
+
+static PyObject* EBoxPY_Process_Freeze(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	unsigned long long address = 0;
+	unsigned long long type = 0;
+	PyObject* value = NULL;
+	unsigned long long interval = 1000;
+	if (!PyArg_ParseTuple(args, "KKO|K", &address, &type, &value, &interval))
+		return NULL;
+	if (interval < EBOXPY_FREEZE_MINIMUM) {
+		PyErr_Format(PyExc_RuntimeError, "EBoxPY.Process.Freeze Requires _Interval >= %d.", EBOXPY_FREEZE_MINIMUM);
+		return NULL;
+	}
+	_EBoxPY_Freeze_Entry entry;
+	memset(&entry, 0, sizeof(_EBoxPY_Freeze_Entry));
+	entry.Address_ = address;
+	entry.Size_ = _EBoxPY_GetNativeSize(type);
+	if (!entry.Size_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Freeze requires a valid _Type.");
+		return NULL;
+	}
+	if (!_EBoxPY_PythonToNative(value, entry.Value_, type) || PyErr_Occurred()) {
+		PyErr_Clear();
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Freeze failed to convert _Value to the Native _Type.");
+		return NULL;
+	}
+	if (!self->Freezer_) {
+		self->Freezer_ = _EBoxPY_Freezer_Create(self);
+		if (!self->Freezer_) {
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Freeze failed to Create the freeze Thread.");
+			return NULL;
+		}
+	}
+	_PEBoxPY_Freezer freezer = self->Freezer_;
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER now;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&now);
+	entry.Interval_ = (long long)((double)frequency.QuadPart * (double)interval / 1000000.0);
+	entry.Next_ = now.QuadPart;
+	EnterCriticalSection(&freezer->Lock_);
+	if (freezer->Count_ == freezer->Capacity_) {
+		unsigned long long capacity = (freezer->Capacity_ ? freezer->Capacity_ * 2 : 16);
+		_PEBoxPY_Freeze_Entry entries = (_PEBoxPY_Freeze_Entry)realloc(freezer->Entries_, (size_t)capacity * sizeof(_EBoxPY_Freeze_Entry));
+		if (!entries) {
+			LeaveCriticalSection(&freezer->Lock_);
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Freeze failed to Allocate entry.");
+			return NULL;
+		}
+		freezer->Entries_ = entries;
+		freezer->Capacity_ = capacity;
+	}
+	entry.Handle_ = freezer->NextHandle_++;
+	freezer->Entries_[freezer->Count_++] = entry;
+	LeaveCriticalSection(&freezer->Lock_);
+	SetEvent(freezer->Wake_);
+	return PyLong_FromUnsignedLongLong(entry.Handle_);
+}
+
+static PyObject* EBoxPY_Process_Unfreeze(PEBoxPY_Process self, PyObject* handle) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (!PyLong_Check(handle)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Unfreeze requires _Handle to be int.");
+		return NULL;
+	}
+	unsigned long long key = PyLong_AsUnsignedLongLong(handle);
+	if (PyErr_Occurred())
+		return NULL;
+	_PEBoxPY_Freezer freezer = self->Freezer_;
+	_PEBoxPY_Freeze_Entry entry = NULL;
+	if (freezer) {
+		EnterCriticalSection(&freezer->Lock_);
+		entry = _EBoxPY_Freezer_Find(freezer, key);
+		if (entry) {
+			unsigned long long index = (unsigned long long)(entry - freezer->Entries_);
+			memmove(entry, entry + 1, (size_t)(freezer->Count_ - index - 1) * sizeof(_EBoxPY_Freeze_Entry));
+			--freezer->Count_;
+		}
+		LeaveCriticalSection(&freezer->Lock_);
+	}
+	if (!entry) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Unfreeze was given an unknown _Handle.");
+		return NULL;
+	}
+	SetEvent(freezer->Wake_);
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Process_GetFrozen(PEBoxPY_Process self) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	PyObject* output = PyList_New(0);
+	if (!output)
+		return NULL;
+	_PEBoxPY_Freezer freezer = self->Freezer_;
+	if (!freezer)
+		return output;
+	EnterCriticalSection(&freezer->Lock_);
+	for (unsigned long long i = 0; i < freezer->Count_; ++i) {
+		_PEBoxPY_Freeze_Entry entry = &freezer->Entries_[i];
+		PyObject* item = Py_BuildValue("(KKKKk)", entry->Handle_, entry->Address_, entry->Writes_, entry->Failures_, entry->LastError_);
+		if (!item || PyList_Append(output, item) < 0) {
+			Py_XDECREF(item);
+			LeaveCriticalSection(&freezer->Lock_);
+			Py_DECREF(output);
+			return NULL;
+		}
+		Py_DECREF(item);
+	}
+	LeaveCriticalSection(&freezer->Lock_);
+	return output;
+}
+
+/*
+ *
+ * EBoxPY.Arena
+ *
+ */
+
+PyDoc_STRVAR(EBoxPY_Arena__doc__, "EBoxPY Arena object, a single remote Allocation sub-allocated with size classes, the bookkeeping lives in this Process.");
+
+#define EBOXPY_ARENA_FREE 0xFF
+#define EBOXPY_ARENA_RUN 0xFE
+#define EBOXPY_ARENA_RUN_TAIL 0xFD
+#define EBOXPY_ARENA_CLASSES 14
+#define EBOXPY_ARENA_NONE 0xFFFFFFFF
+
+// Blocks up to 2048 bytes are carved from single page slabs, larger ones take a run of whole pages.
+static const unsigned long _EBoxPY_Arena_Classes[EBOXPY_ARENA_CLASSES] = { 16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048 };
+
+typedef struct EBoxPY_Arena_T {
+	//
+	PyObject_HEAD
+	//
+	PyObject* Process_;
+	unsigned long long Address_;
+	unsigned long long Size_;
+	unsigned long long Used_;
+	unsigned long Protection_;
+	char IsReleased_;
+	//
+	unsigned long PageCount_;
+	unsigned char* PageClass_;
+	unsigned long* PageRun_;
+	unsigned short* PageUsed_;
+	unsigned long long* PageSlots_;
+	unsigned long* PagePrevious_;
+	unsigned long* PageNext_;
+	unsigned long Partial_[EBOXPY_ARENA_CLASSES];
+	unsigned long Hint_;
+	//
+} EBoxPY_Arena, *PEBoxPY_Arena;
+
+static void EBoxPY_Arena_dealloc(PyObject* self);
+static PyObject* EBoxPY_Arena_repr(PyObject* self);
+
+static PyObject* EBoxPY_Arena_Allocate(PEBoxPY_Arena self, PyObject* size);
+static PyObject* EBoxPY_Arena_Free(PEBoxPY_Arena self, PyObject* allocation);
+static PyObject* EBoxPY_Arena_Release(PEBoxPY_Arena self);
+
+static PyMemberDef EBoxPY_Arena_Members[] = {
+	{"Process_", T_OBJECT, offsetof(EBoxPY_Arena, Process_), READONLY, PyDoc_STR("The Process the Arena lives in.")},
+	{"Address_", T_ULONGLONG, offsetof(EBoxPY_Arena, Address_), READONLY, PyDoc_STR("The remote Address of the Arena.")},
+	{"Size_", T_ULONGLONG, offsetof(EBoxPY_Arena, Size_), READONLY, PyDoc_STR("The Size of the Arena.")},
+	{"Used_", T_ULONGLONG, offsetof(EBoxPY_Arena, Used_), READONLY, PyDoc_STR("The number of bytes handed out, rounded up to their size class.")},
+	{"Protection_", T_ULONG, offsetof(EBoxPY_Arena, Protection_), READONLY, PyDoc_STR("The Protection the Arena was Allocated with.")},
+	{"IsReleased_", T_BOOL, offsetof(EBoxPY_Arena, IsReleased_), READONLY, PyDoc_STR("True once the Arena has been Released.")},
+	{NULL}
+};
+
+static PyMethodDef EBoxPY_Arena_Methods[] = {
+	{"Allocate", (PyCFunction)EBoxPY_Arena_Allocate, METH_O, PyDoc_STR("EBoxPY.Arena.Allocate(_Size) -> int\nHands out a block of at least _Size bytes from the Arena, no system call is made.")},
+	{"Free", (PyCFunction)EBoxPY_Arena_Free, METH_O, PyDoc_STR("EBoxPY.Arena.Free(_Allocation)\nReturns a block to the Arena, no system call is made.")},
+	{"Release", (PyCFunction)EBoxPY_Arena_Release, METH_NOARGS, PyDoc_STR("EBoxPY.Arena.Release()\nFrees the whole Arena in the Process with a single call, every block becomes invalid.")},
+	{NULL}
+};
+
+static PyTypeObject EBoxPY_Arena_Type = {
+	PyObject_HEAD_INIT(NULL)
+	.tp_name = "EBoxPY.Arena",
+	.tp_basicsize = sizeof(EBoxPY_Arena),
+	.tp_doc = EBoxPY_Arena__doc__,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_members = EBoxPY_Arena_Members,
+	.tp_dealloc = EBoxPY_Arena_dealloc,
+	.tp_repr = EBoxPY_Arena_repr,
+	.tp_str = EBoxPY_Arena_repr,
+	.tp_methods = EBoxPY_Arena_Methods,
+};
+
+static int _EBoxPY_Initialize_Arena(PyObject* self) {
+	if (PyType_Ready(&EBoxPY_Arena_Type) < 0)
+		return 0;
+	PyModule_AddObject(self, "Arena", (PyObject*)&EBoxPY_Arena_Type);
+	return 1;
+}
+
+static void _EBoxPY_Arena_Free_Tables(PEBoxPY_Arena _Arena) {
+	free(_Arena->PageClass_);
+	free(_Arena->PageRun_);
+	free(_Arena->PageUsed_);
+	free(_Arena->PageSlots_);
+	free(_Arena->PagePrevious_);
+	free(_Arena->PageNext_);
+	_Arena->PageClass_ = NULL;
+	_Arena->PageRun_ = NULL;
+	_Arena->PageUsed_ = NULL;
+	_Arena->PageSlots_ = NULL;
+	_Arena->PagePrevious_ = NULL;
+	_Arena->PageNext_ = NULL;
+}
+
+static void EBoxPY_Arena_dealloc(PyObject* self) {
+	PEBoxPY_Arena arena = (PEBoxPY_Arena)self;
+	_EBoxPY_Arena_Free_Tables(arena);
+	Py_XDECREF(arena->Process_);
+	Py_TYPE(self)->tp_free(self);
+}
+
+static PyObject* EBoxPY_Arena_repr(PyObject* self) {
+	PEBoxPY_Arena arena = (PEBoxPY_Arena)self;
+	char buffer[128] = {0};
+	sprintf(buffer, "<EBoxPY.Arena: (Address: %p) (Size: %llu) (Used: %llu)>", (void*)arena->Address_, arena->Size_, arena->Used_);
+	return PyUnicode_FromString(buffer);
+}
+
+// First fit over the page table starting at Hint_, returns EBOXPY_ARENA_NONE when no run of _Count pages is free.
+static unsigned long _EBoxPY_Arena_Take_Pages(PEBoxPY_Arena _Arena, unsigned long _Count) {
+	for (int pass = 0; pass < 2; ++pass) {
+		unsigned long page = (pass ? 0 : _Arena->Hint_);
+		unsigned long limit = (pass ? _Arena->Hint_ + _Count : _Arena->PageCount_);
+		if (limit > _Arena->PageCount_)
+			limit = _Arena->PageCount_;
+		while (page + _Count <= limit) {
+			unsigned long length = 0;
+			while (length < _Count && _Arena->PageClass_[page + length] == EBOXPY_ARENA_FREE)
+				++length;
+			if (length == _Count) {
+				_Arena->Hint_ = page + _Count;
+				if (_Arena->Hint_ >= _Arena->PageCount_)
+					_Arena->Hint_ = 0;
+				return page;
+			}
+			page += length + 1;
+		}
+	}
+	return EBOXPY_ARENA_NONE;
+}
+
+static void _EBoxPY_Arena_Unlink(PEBoxPY_Arena _Arena, unsigned long _Class, unsigned long _Page) {
+	unsigned long previous = _Arena->PagePrevious_[_Page];
+	unsigned long next = _Arena->PageNext_[_Page];
+	if (previous != EBOXPY_ARENA_NONE)
+		_Arena->PageNext_[previous] = next;
+	else
+		_Arena->Partial_[_Class] = next;
+	if (next != EBOXPY_ARENA_NONE)
+		_Arena->PagePrevious_[next] = previous;
+}
+
+static void _EBoxPY_Arena_Link(PEBoxPY_Arena _Arena, unsigned long _Class, unsigned long _Page) {
+	_Arena->PagePrevious_[_Page] = EBOXPY_ARENA_NONE;
+	_Arena->PageNext_[_Page] = _Arena->Partial_[_Class];
+	if (_Arena->Partial_[_Class] != EBOXPY_ARENA_NONE)
+		_Arena->PagePrevious_[_Arena->Partial_[_Class]] = _Page;
+	_Arena->Partial_[_Class] = _Page;
+}
+
+static unsigned long long _EBoxPY_Arena_Allocate(PEBoxPY_Arena _Arena, unsigned long long _Size) {
+	if (!_Size)
+		_Size = 1;
+	if (_Size > _EBoxPY_Arena_Classes[EBOXPY_ARENA_CLASSES - 1]) {
+		unsigned long long count = (_Size + EBOXPY_PAGE_SIZE - 1) / EBOXPY_PAGE_SIZE;
+		if (count > _Arena->PageCount_)
+			return 0;
+		unsigned long page = _EBoxPY_Arena_Take_Pages(_Arena, (unsigned long)count);
+		if (page == EBOXPY_ARENA_NONE)
+			return 0;
+		_Arena->PageClass_[page] = EBOXPY_ARENA_RUN;
+		for (unsigned long i = 1; i < (unsigned long)count; ++i)
+			_Arena->PageClass_[page + i] = EBOXPY_ARENA_RUN_TAIL;
+		_Arena->PageRun_[page] = (unsigned long)count;
+		_Arena->Used_ += count * EBOXPY_PAGE_SIZE;
+		return _Arena->Address_ + (unsigned long long)page * EBOXPY_PAGE_SIZE;
+	}
+	unsigned long _class = 0;
+	while (_EBoxPY_Arena_Classes[_class] < _Size)
+		++_class;
+	unsigned long size = _EBoxPY_Arena_Classes[_class];
+	unsigned long slots = EBOXPY_PAGE_SIZE / size;
+	unsigned long page = _Arena->Partial_[_class];
+	if (page == EBOXPY_ARENA_NONE) {
+		page = _EBoxPY_Arena_Take_Pages(_Arena, 1);
+		if (page == EBOXPY_ARENA_NONE)
+			return 0;
+		_Arena->PageClass_[page] = (unsigned char)_class;
+		_Arena->PageUsed_[page] = 0;
+		memset(&_Arena->PageSlots_[page * 4], 0, 4 * sizeof(unsigned long long));
+		_EBoxPY_Arena_Link(_Arena, _class, page);
+	}
+	unsigned long long* bits = &_Arena->PageSlots_[page * 4];
+	unsigned long slot = 0;
+	for (unsigned long i = 0; i < 4; ++i) {
+		unsigned long index = 0;
+		if (~bits[i] && _BitScanForward64(&index, ~bits[i])) {
+			slot = i * 64 + index;
+			break;
+		}
+	}
+	bits[slot / 64] |= (1ull << (slot % 64));
+	if (++_Arena->PageUsed_[page] == slots)
+		_EBoxPY_Arena_Unlink(_Arena, _class, page);
+	_Arena->Used_ += size;
+	return _Arena->Address_ + (unsigned long long)page * EBOXPY_PAGE_SIZE + (unsigned long long)slot * size;
+}
+
+static int _EBoxPY_Arena_Free(PEBoxPY_Arena _Arena, unsigned long long _Address) {
+	if (_Address < _Arena->Address_ || _Address >= _Arena->Address_ + _Arena->Size_)
+		return 0;
+	unsigned long long offset = _Address - _Arena->Address_;
+	unsigned long page = (unsigned long)(offset / EBOXPY_PAGE_SIZE);
+	unsigned char _class = _Arena->PageClass_[page];
+	if (_class == EBOXPY_ARENA_RUN) {
+		if (offset % EBOXPY_PAGE_SIZE)
+			return 0;
+		unsigned long count = _Arena->PageRun_[page];
+		memset(&_Arena->PageClass_[page], EBOXPY_ARENA_FREE, count);
+		_Arena->Used_ -= (unsigned long long)count * EBOXPY_PAGE_SIZE;
+		return 1;
+	}
+	if (_class >= EBOXPY_ARENA_CLASSES)
+		return 0;
+	unsigned long size = _EBoxPY_Arena_Classes[_class];
+	unsigned long slots = EBOXPY_PAGE_SIZE / size;
+	unsigned long long within = offset % EBOXPY_PAGE_SIZE;
+	unsigned long slot = (unsigned long)(within / size);
+	unsigned long long* bits = &_Arena->PageSlots_[page * 4];
+	if (within % size || slot >= slots || !(bits[slot / 64] & (1ull << (slot % 64))))
+		return 0;
+	bits[slot / 64] &= ~(1ull << (slot % 64));
+	if (_Arena->PageUsed_[page]-- == slots)
+		_EBoxPY_Arena_Link(_Arena, _class, page);
+	// Empty slabs go back to the page pool so that other classes and runs can use them.
+	if (!_Arena->PageUsed_[page]) {
+		_EBoxPY_Arena_Unlink(_Arena, _class, page);
+		_Arena->PageClass_[page] = EBOXPY_ARENA_FREE;
+	}
+	_Arena->Used_ -= size;
+	return 1;
+}
+
+static PyObject* EBoxPY_Arena_Allocate(PEBoxPY_Arena self, PyObject* size) {
+	if (self->IsReleased_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Arena.IsReleased_ was True.");
+		return NULL;
+	}
+	if (!PyLong_Check(size)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Arena.Allocate requires _Size to be int.");
+		return NULL;
+	}
+	unsigned long long _size = PyLong_AsUnsignedLongLong(size);
+	if (PyErr_Occurred())
+		return NULL;
+	unsigned long long address = _EBoxPY_Arena_Allocate(self, _size);
+	if (!address) {
+		PyErr_SetString(PyExc_MemoryError, "EBoxPY.Arena.Allocate failed, the Arena is exhausted.");
+		return NULL;
+	}
+	return PyLong_FromUnsignedLongLong(address);
+}
+
+static PyObject* EBoxPY_Arena_Free(PEBoxPY_Arena self, PyObject* allocation) {
+	if (self->IsReleased_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Arena.IsReleased_ was True.");
+		return NULL;
+	}
+	if (!PyLong_Check(allocation)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Arena.Free requires int as _Allocation.");
+		return NULL;
+	}
+	unsigned long long address = PyLong_AsUnsignedLongLong(allocation);
+	if (PyErr_Occurred())
+		return NULL;
+	if (!_EBoxPY_Arena_Free(self, address)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Arena.Free was given an Address that is not an allocated block.");
+		return NULL;
+	}
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Arena_Release(PEBoxPY_Arena self) {
+	if (self->IsReleased_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Arena.IsReleased_ was already True.");
+		return NULL;
+	}
+	PEBoxPY_Process process = (PEBoxPY_Process)self->Process_;
+	if (!process->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (!VirtualFreeEx(process->Process_, (void*)self->Address_, 0, MEM_RELEASE)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Arena.Release Failed to Free Memory.");
+		return NULL;
+	}
+	_EBoxPY_Arena_Free_Tables(self);
+	self->Used_ = 0;
+	self->IsReleased_ = 1;
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Process_CreateArena(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	unsigned long long size = 0;
+	unsigned long protection = PAGE_EXECUTE_READWRITE;
+	if (!PyArg_ParseTuple(args, "K|k", &size, &protection))
+		return NULL;
+	size = (size + EBOXPY_PAGE_SIZE - 1) & ~((unsigned long long)EBOXPY_PAGE_SIZE - 1);
+	if (!size || size / EBOXPY_PAGE_SIZE >= EBOXPY_ARENA_NONE) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.CreateArena requires a valid _Size.");
+		return NULL;
+	}
+	PyObject* output = EBoxPY_Arena_Type.tp_alloc(&EBoxPY_Arena_Type, 1);
+	if (!output)
+		return NULL;
+	EBOXPY_OBJECT_ZERO(EBoxPY_Arena, output);
+	PEBoxPY_Arena arena = (PEBoxPY_Arena)output;
+	Py_INCREF((PyObject*)self);
+	arena->Process_ = (PyObject*)self;
+	arena->Size_ = size;
+	arena->Protection_ = protection;
+	arena->PageCount_ = (unsigned long)(size / EBOXPY_PAGE_SIZE);
+	arena->PageClass_ = (unsigned char*)malloc(arena->PageCount_);
+	arena->PageRun_ = (unsigned long*)calloc(arena->PageCount_, sizeof(unsigned long));
+	arena->PageUsed_ = (unsigned short*)calloc(arena->PageCount_, sizeof(unsigned short));
+	arena->PageSlots_ = (unsigned long long*)calloc((size_t)arena->PageCount_ * 4, sizeof(unsigned long long));
+	arena->PagePrevious_ = (unsigned long*)calloc(arena->PageCount_, sizeof(unsigned long));
+	arena->PageNext_ = (unsigned long*)calloc(arena->PageCount_, sizeof(unsigned long));
+	if (!arena->PageClass_ || !arena->PageRun_ || !arena->PageUsed_ || !arena->PageSlots_ || !arena->PagePrevious_ || !arena->PageNext_) {
+		Py_DECREF(output);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.CreateArena failed to Allocate the page table.");
+		return NULL;
+	}
+	memset(arena->PageClass_, EBOXPY_ARENA_FREE, arena->PageCount_);
+	for (unsigned long i = 0; i < EBOXPY_ARENA_CLASSES; ++i)
+		arena->Partial_[i] = EBOXPY_ARENA_NONE;
+	arena->Address_ = (unsigned long long)VirtualAllocEx(self->Process_, NULL, (SIZE_T)size, MEM_COMMIT | MEM_RESERVE, protection);
+	if (!arena->Address_) {
+		Py_DECREF(output);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.CreateArena Failed to Allocate Memory.");
+		return NULL;
+	}
+	return output;
+}
+
+/*
+ *
+ * EBoxPY.Debugger
+ *
+ */
+
+PyDoc_STRVAR(EBoxPY_Debugger__doc__, "EBoxPY Debugger object, a native debug loop attached to a Process that records Hardware Breakpoint hits.\nEach record is a UINT64 timestamp in nanoseconds since the Debugger started, the UINT64 Address, the UINT32 Thread ID, the UINT32 Breakpoint Index, then one UINT64 per requested Register, see Format_.");
+
+#define EBOXPY_DEBUGGER_REGISTERS 32
+#define EBOXPY_DEBUGGER_RESUME 0x10000
+#define EBOXPY_DEBUGGER_TRAP 0x100
+#define EBOXPY_DEBUGGER_BREAKPOINTS 4
+
+#define EBOXPY_FILTER_LENGTH 64
+#define EBOXPY_FILTER_DEPTH 32
+
+#define EBOXPY_FILTER_CONSTANT 0
+#define EBOXPY_FILTER_REGISTER 1
+#define EBOXPY_FILTER_LOAD 2
+#define EBOXPY_FILTER_NOT 3
+#define EBOXPY_FILTER_NEGATE 4
+#define EBOXPY_FILTER_INVERT 5
+#define EBOXPY_FILTER_ADD 6
+#define EBOXPY_FILTER_SUBTRACT 7
+#define EBOXPY_FILTER_MULTIPLY 8
+#define EBOXPY_FILTER_BIT_AND 9
+#define EBOXPY_FILTER_BIT_OR 10
+#define EBOXPY_FILTER_BIT_XOR 11
+#define EBOXPY_FILTER_EQUAL 12
+#define EBOXPY_FILTER_NOT_EQUAL 13
+#define EBOXPY_FILTER_LESS 14
+#define EBOXPY_FILTER_LESS_EQUAL 15
+#define EBOXPY_FILTER_GREATER 16
+#define EBOXPY_FILTER_GREATER_EQUAL 17
+#define EBOXPY_FILTER_AND 18
+#define EBOXPY_FILTER_OR 19
+#define EBOXPY_FILTER_JUMP_FALSE 20
+#define EBOXPY_FILTER_JUMP_TRUE 21
+
+typedef struct _EBoxPY_Filter_Instruction_T {
+	unsigned long Operation_;
+	unsigned long Size_;
+	unsigned long long Value_;
+} _EBoxPY_Filter_Instruction, *_PEBoxPY_Filter_Instruction;
+
+// A condition compiled to postfix, evaluated by the debug loop for every hit on its Breakpoint.
+typedef struct _EBoxPY_Filter_T {
+	_EBoxPY_Filter_Instruction Code_[EBOXPY_FILTER_LENGTH];
+	unsigned long long Length_;
+	unsigned long long Skip_;
+	unsigned long long Hits_;
+	unsigned long long Matches_;
+} _EBoxPY_Filter, *_PEBoxPY_Filter;
+
+typedef struct _EBoxPY_Debugger_Thread_T {
+	unsigned long ID_;
+	HANDLE Thread_;
+	unsigned long long Rearm_;
+} _EBoxPY_Debugger_Thread, *_PEBoxPY_Debugger_Thread;
+
+// A watched range, kept sorted by Start_ with Reach_ the largest End_ up to it, so a stab stops early.
+typedef struct _EBoxPY_Watchpoint_T {
+	unsigned long long Start_;
+	unsigned long long End_;
+	unsigned long long Reach_;
+	unsigned long long Handle_;
+	int Condition_;
+} _EBoxPY_Watchpoint, *_PEBoxPY_Watchpoint;
+
+// A page carrying PAGE_GUARD for one or more Watchpoints, Protect_ is what it had before.
+typedef struct _EBoxPY_Guard_T {
+	unsigned long long Page_;
+	unsigned long Protect_;
+	unsigned long long Count_;
+} _EBoxPY_Guard, *_PEBoxPY_Guard;
+
+typedef struct EBoxPY_Debugger_T {
+	//
+	PyObject_HEAD
+	//
+	PyObject* Process_;
+	PyObject* Format_;
+	unsigned long long RecordSize_;
+	unsigned long long Capacity_;
+	volatile LONG64 Hits_;
+	char IsRunning_;
+	//
+	unsigned long ID_;
+	HANDLE Thread_;
+	HANDLE Ready_;
+	volatile LONG Stop_;
+	int Attached_;
+	char Initial_;
+	long long Start_;
+	long long Frequency_;
+	_PEBoxPY_Debugger_Thread Threads_;
+	unsigned long long ThreadCount_;
+	unsigned long long ThreadCapacity_;
+	unsigned long long Registers_[EBOXPY_DEBUGGER_REGISTERS];
+	unsigned long long RegisterCount_;
+	_EBoxPY_Ring Ring_;
+	HANDLE Target_;
+	SRWLOCK Lock_;
+	_EBoxPY_Filter Filters_[EBOXPY_DEBUGGER_BREAKPOINTS];
+	_PEBoxPY_Watchpoint Watchpoints_;
+	unsigned long long WatchpointCount_;
+	unsigned long long WatchpointCapacity_;
+	unsigned long long NextWatchpoint_;
+	_PEBoxPY_Guard Guards_;
+	unsigned long long GuardCount_;
+	unsigned long long GuardCapacity_;
+	//
+} EBoxPY_Debugger, *PEBoxPY_Debugger;
+
+static void EBoxPY_Debugger_dealloc(PyObject* self);
+static PyObject* EBoxPY_Debugger_repr(PyObject* self);
+
+static PyObject* EBoxPY_Debugger_Drain(PEBoxPY_Debugger self, PyObject* args);
+static PyObject* EBoxPY_Debugger_Stop(PEBoxPY_Debugger self);
+static PyObject* EBoxPY_Debugger_SetFilter(PEBoxPY_Debugger self, PyObject* args);
+static PyObject* EBoxPY_Debugger_GetCounts(PEBoxPY_Debugger self);
+static PyObject* EBoxPY_Debugger_Watch(PEBoxPY_Debugger self, PyObject* args);
+static PyObject* EBoxPY_Debugger_Unwatch(PEBoxPY_Debugger self, PyObject* handle);
+
+static PyMemberDef EBoxPY_Debugger_Members[] = {
+	{"Process_", T_OBJECT, offsetof(EBoxPY_Debugger, Process_), READONLY, PyDoc_STR("The Process being debugged.")},
+	{"Format_", T_OBJECT, offsetof(EBoxPY_Debugger, Format_), READONLY, PyDoc_STR("The struct module format of a single record.")},
+	{"RecordSize_", T_ULONGLONG, offsetof(EBoxPY_Debugger, RecordSize_), READONLY, PyDoc_STR("The Size of a single record.")},
+	{"Capacity_", T_ULONGLONG, offsetof(EBoxPY_Debugger, Capacity_), READONLY, PyDoc_STR("The number of records buffered before hits are Dropped.")},
+	{"Dropped_", T_LONGLONG, offsetof(EBoxPY_Debugger, Ring_) + offsetof(_EBoxPY_Ring, Dropped_), READONLY, PyDoc_STR("The number of hits Dropped because the buffer was full.")},
+	{"Hits_", T_LONGLONG, offsetof(EBoxPY_Debugger, Hits_), READONLY, PyDoc_STR("The number of Breakpoint hits serviced.")},
+	{"IsRunning_", T_BOOL, offsetof(EBoxPY_Debugger, IsRunning_), READONLY, PyDoc_STR("True until the Debugger is Stopped or the Process exits.")},
+	{NULL}
+};
+
+static PyMethodDef EBoxPY_Debugger_Methods[] = {
+	{"Drain", (PyCFunction)EBoxPY_Debugger_Drain, METH_VARARGS, PyDoc_STR("EBoxPY.Debugger.Drain(_Maximum=0) -> bytes\nRemoves up to _Maximum buffered records, or every buffered record when 0.")},
+	{"SetFilter", (PyCFunction)EBoxPY_Debugger_SetFilter, METH_VARARGS, PyDoc_STR("EBoxPY.Debugger.SetFilter(_Index, _Expression=None, _Skip=0)\nOnly records hits on Breakpoint _Index where _Expression is non zero, after skipping the first _Skip matches.\nExpressions use unsigned 64 bit integers, Registers such as RCX, memory reads such as [RDX+8] or DWORD[RDX+8], arithmetic + - * & | ^ ~, comparisons and and, or, not.\nNumbers are decimal unless prefixed with 0x, and / or skip their right operand once the left one decides, a failed memory read only leaves its own operand unknown.")},
+	{"GetCounts", (PyCFunction)EBoxPY_Debugger_GetCounts, METH_NOARGS, PyDoc_STR("EBoxPY.Debugger.GetCounts() -> list\nReturns a (Hits, Matches) tuple for each Breakpoint Index.")},
+	{"Watch", (PyCFunction)EBoxPY_Debugger_Watch, METH_VARARGS, PyDoc_STR("EBoxPY.Debugger.Watch(_Address, _Size, _Condition=EBoxPY.ACCESS) -> int\nWatches any number of ranges by guarding their pages, returns a handle >= 4 which is also the record Index of its hits.\nAccesses elsewhere on a guarded page are resumed natively, accesses by other Threads while a page is re-armed are missed.")},
+	{"Unwatch", (PyCFunction)EBoxPY_Debugger_Unwatch, METH_O, PyDoc_STR("EBoxPY.Debugger.Unwatch(_Handle)\nStops watching a range started with Watch, restoring page protection once no Watchpoint uses it.")},
+	{"Stop", (PyCFunction)EBoxPY_Debugger_Stop, METH_NOARGS, PyDoc_STR("EBoxPY.Debugger.Stop()\nDetaches from the Process, buffered records remain Drainable.")},
+	{NULL}
+};
+
+static PyTypeObject EBoxPY_Debugger_Type = {
+	PyObject_HEAD_INIT(NULL)
+	.tp_name = "EBoxPY.Debugger",
+	.tp_basicsize = sizeof(EBoxPY_Debugger),
+	.tp_doc = EBoxPY_Debugger__doc__,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_members = EBoxPY_Debugger_Members,
+	.tp_dealloc = EBoxPY_Debugger_dealloc,
+	.tp_repr = EBoxPY_Debugger_repr,
+	.tp_str = EBoxPY_Debugger_repr,
+	.tp_methods = EBoxPY_Debugger_Methods,
+};
+
+static int _EBoxPY_Initialize_Debugger(PyObject* self) {
+	if (PyType_Ready(&EBoxPY_Debugger_Type) < 0)
+		return 0;
+	PyModule_AddObject(self, "Debugger", (PyObject*)&EBoxPY_Debugger_Type);
+	return 1;
+}
+
+// Threads_ is sorted by ID_ and only ever touched by the debug loop.
+static unsigned long long _EBoxPY_Debugger_Find(PEBoxPY_Debugger _Debugger, unsigned long _ID) {
+	unsigned long long low = 0;
+	unsigned long long high = _Debugger->ThreadCount_;
+	while (low < high) {
+		unsigned long long middle = low + (high - low) / 2;
+		if (_Debugger->Threads_[middle].ID_ < _ID)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return low;
+}
+
+static _PEBoxPY_Debugger_Thread _EBoxPY_Debugger_Get_Thread(PEBoxPY_Debugger _Debugger, unsigned long _ID) {
+	unsigned long long index = _EBoxPY_Debugger_Find(_Debugger, _ID);
+	if (index < _Debugger->ThreadCount_ && _Debugger->Threads_[index].ID_ == _ID)
+		return &_Debugger->Threads_[index];
+	return NULL;
+}
+
+static void _EBoxPY_Debugger_Add_Thread(PEBoxPY_Debugger _Debugger, unsigned long _ID, HANDLE _Thread) {
+	unsigned long long index = _EBoxPY_Debugger_Find(_Debugger, _ID);
+	if (index < _Debugger->ThreadCount_ && _Debugger->Threads_[index].ID_ == _ID) {
+		_Debugger->Threads_[index].Thread_ = _Thread;
+		return;
+	}
+	if (_Debugger->ThreadCount_ == _Debugger->ThreadCapacity_) {
+		unsigned long long capacity = (_Debugger->ThreadCapacity_ ? _Debugger->ThreadCapacity_ * 2 : 64);
+		_PEBoxPY_Debugger_Thread threads = (_PEBoxPY_Debugger_Thread)realloc(_Debugger->Threads_, (size_t)capacity * sizeof(_EBoxPY_Debugger_Thread));
+		if (!threads)
+			return;
+		_Debugger->Threads_ = threads;
+		_Debugger->ThreadCapacity_ = capacity;
+	}
+	memmove(&_Debugger->Threads_[index + 1], &_Debugger->Threads_[index], (size_t)(_Debugger->ThreadCount_ - index) * sizeof(_EBoxPY_Debugger_Thread));
+	_Debugger->Threads_[index].ID_ = _ID;
+	_Debugger->Threads_[index].Thread_ = _Thread;
+	_Debugger->Threads_[index].Rearm_ = 0;
+	++_Debugger->ThreadCount_;
+}
+
+static void _EBoxPY_Debugger_Remove_Thread(PEBoxPY_Debugger _Debugger, unsigned long _ID) {
+	unsigned long long index = _EBoxPY_Debugger_Find(_Debugger, _ID);
+	if (index >= _Debugger->ThreadCount_ || _Debugger->Threads_[index].ID_ != _ID)
+		return;
+	memmove(&_Debugger->Threads_[index], &_Debugger->Threads_[index + 1], (size_t)(_Debugger->ThreadCount_ - index - 1) * sizeof(_EBoxPY_Debugger_Thread));
+	--_Debugger->ThreadCount_;
+}
+
+static void _EBoxPY_Debugger_Record(PEBoxPY_Debugger _Debugger, unsigned long _Thread, unsigned long _Index, unsigned long long _Address, CONTEXT* _Context) {
+	unsigned char* record = _EBoxPY_Ring_Reserve(&_Debugger->Ring_);
+	if (!record)
+		return;
+	LARGE_INTEGER now;
+	QueryPerformanceCounter(&now);
+	((unsigned long long*)record)[0] = (unsigned long long)((double)(now.QuadPart - _Debugger->Start_) * 1000000000.0 / (double)_Debugger->Frequency_);
+	((unsigned long long*)record)[1] = _Address;
+	((unsigned long*)record)[4] = _Thread;
+	((unsigned long*)record)[5] = _Index;
+	for (unsigned long long i = 0; i < _Debugger->RegisterCount_; ++i)
+		memcpy(record + 24 + i * 8, (unsigned char*)_Context + _Debugger->Registers_[i], 8);
+	_EBoxPY_Ring_Commit(&_Debugger->Ring_);
+}
+
+typedef struct _EBoxPY_Filter_Parser_T {
+	const char* Text_;
+	_PEBoxPY_Filter Filter_;
+	unsigned long long Depth_;
+	const char* Error_;
+} _EBoxPY_Filter_Parser, *_PEBoxPY_Filter_Parser;
+
+static int _EBoxPY_Filter_Emit(_PEBoxPY_Filter_Parser _Parser, unsigned long _Operation, unsigned long _Size, unsigned long long _Value) {
+	if (_Parser->Filter_->Length_ == EBOXPY_FILTER_LENGTH) {
+		_Parser->Error_ = "EBoxPY.Debugger.SetFilter _Expression was too long.";
+		return 0;
+	}
+	if (_Operation <= EBOXPY_FILTER_REGISTER) {
+		if (++_Parser->Depth_ > EBOXPY_FILTER_DEPTH) {
+			_Parser->Error_ = "EBoxPY.Debugger.SetFilter _Expression was nested too deeply.";
+			return 0;
+		}
+	}
+	else if (_Operation >= EBOXPY_FILTER_ADD && _Operation <= EBOXPY_FILTER_OR) {
+		--_Parser->Depth_;
+	}
+	_PEBoxPY_Filter_Instruction instruction = &_Parser->Filter_->Code_[_Parser->Filter_->Length_++];
+	instruction->Operation_ = _Operation;
+	instruction->Size_ = _Size;
+	instruction->Value_ = _Value;
+	return 1;
+}
+
+static int _EBoxPY_Filter_Identifier(char _Character) {
+	return isalnum((unsigned char)_Character) || _Character == '_';
+}
+
+// Consumes _Token if it is next, words only match on a whole identifier.
+static int _EBoxPY_Filter_Accept(_PEBoxPY_Filter_Parser _Parser, const char* _Token) {
+	while (isspace((unsigned char)*_Parser->Text_))
+		++_Parser->Text_;
+	size_t length = strlen(_Token);
+	for (size_t i = 0; i < length; ++i) {
+		if (toupper((unsigned char)_Parser->Text_[i]) != toupper((unsigned char)_Token[i]))
+			return 0;
+	}
+	if (_EBoxPY_Filter_Identifier(_Token[0]) && _EBoxPY_Filter_Identifier(_Parser->Text_[length]))
+		return 0;
+	// Keeps | and & from eating || and &&.
+	if (length == 1 && (_Token[0] == '|' || _Token[0] == '&') && _Parser->Text_[1] == _Token[0])
+		return 0;
+	_Parser->Text_ += length;
+	return 1;
+}
+
+static int _EBoxPY_Filter_Or(_PEBoxPY_Filter_Parser _Parser);
+
+static int _EBoxPY_Filter_Load(_PEBoxPY_Filter_Parser _Parser, unsigned long _Size) {
+	if (!_EBoxPY_Filter_Accept(_Parser, "[")) {
+		_Parser->Error_ = "EBoxPY.Debugger.SetFilter _Expression expected [ after a memory Size.";
+		return 0;
+	}
+	if (!_EBoxPY_Filter_Or(_Parser))
+		return 0;
+	if (!_EBoxPY_Filter_Accept(_Parser, "]")) {
+		_Parser->Error_ = "EBoxPY.Debugger.SetFilter _Expression expected ].";
+		return 0;
+	}
+	return _EBoxPY_Filter_Emit(_Parser, EBOXPY_FILTER_LOAD, _Size, 0);
+}
+
+static int _EBoxPY_Filter_Primary(_PEBoxPY_Filter_Parser _Parser) {
+	if (_EBoxPY_Filter_Accept(_Parser, "(")) {
+		if (!_EBoxPY_Filter_Or(_Parser))
+			return 0;
+		if (!_EBoxPY_Filter_Accept(_Parser, ")")) {
+			_Parser->Error_ = "EBoxPY.Debugger.SetFilter _Expression expected ).";
+			return 0;
+		}
+		return 1;
+	}
+	if (_EBoxPY_Filter_Accept(_Parser, "BYTE"))
+		return _EBoxPY_Filter_Load(_Parser, 1);
+	if (_EBoxPY_Filter_Accept(_Parser, "WORD"))
+		return _EBoxPY_Filter_Load(_Parser, 2);
+	if (_EBoxPY_Filter_Accept(_Parser, "DWORD"))
+		return _EBoxPY_Filter_Load(_Parser, 4);
+	if (_EBoxPY_Filter_Accept(_Parser, "QWORD"))
+		return _EBoxPY_Filter_Load(_Parser, 8);
+	while (isspace((unsigned char)*_Parser->Text_))
+		++_Parser->Text_;
+	if (*_Parser->Text_ == '[')
+		return _EBoxPY_Filter_Load(_Parser, 8);
+	if (isdigit((unsigned char)*_Parser->Text_)) {
+		// Only 0x selects a base, a leading 0 is still decimal.
+		int hexadecimal = (_Parser->Text_[0] == '0' && (_Parser->Text_[1] == 'x' || _Parser->Text_[1] == 'X'));
+		const char* start = _Parser->Text_ + (hexadecimal ? 2 : 0);
+		char* end = NULL;
+		unsigned long long value = strtoull(start, &end, (hexadecimal ? 16 : 10));
+		if (end == start) {
+			_Parser->Error_ = "EBoxPY.Debugger.SetFilter _Expression expected hexadecimal digits after 0x.";
+			return 0;
+		}
+		_Parser->Text_ = end;
+		return _EBoxPY_Filter_Emit(_Parser, EBOXPY_FILTER_CONSTANT, 0, value);
+	}
+	for (_PEBoxPY_Thread_Register i = _EBoxPY_Thread_Register_List; i->Public_ != NULL; ++i) {
+		if (i->Class_ == EBOXPY_CONTEXT_FLOATING || i->Size_ > 8)
+			continue;
+		if (_EBoxPY_Filter_Accept(_Parser, i->Public_))
+			return _EBoxPY_Filter_Emit(_Parser, EBOXPY_FILTER_REGISTER, (unsigned long)i->Size_, i->Private_);
+	}
+	// EFLAGS is kept out of the Register list so Thread.Lock and Unlock do not carry it.
+	if (_EBoxPY_Filter_Accept(_Parser, "EFLAGS"))
+		return _EBoxPY_Filter_Emit(_Parser, EBOXPY_FILTER_REGISTER, (unsigned long)sizeof(((CONTEXT*)0)->EFlags), (unsigned long long)offsetof(CONTEXT, EFlags));
+	_Parser->Error_ = "EBoxPY.Debugger.SetFilter _Expression expected a number, Register, [ or (.";
+	return 0;
+}
+
+static int _EBoxPY_Filter_Unary(_PEBoxPY_Filter_Parser _Parser) {
+	unsigned long operation = 0;
+	if (_EBoxPY_Filter_Accept(_Parser, "!") || _EBoxPY_Filter_Accept(_Parser, "not"))
+		operation = EBOXPY_FILTER_NOT;
+	else if (_EBoxPY_Filter_Accept(_Parser, "-"))
+		operation = EBOXPY_FILTER_NEGATE;
+	else if (_EBoxPY_Filter_Accept(_Parser, "~"))
+		operation = EBOXPY_FILTER_INVERT;
+	else
+		return _EBoxPY_Filter_Primary(_Parser);
+	if (!_EBoxPY_Filter_Unary(_Parser))
+		return 0;
+	return _EBoxPY_Filter_Emit(_Parser, operation, 0, 0);
+}
+
+// Each binary level is a list of operator tokens and the level below it.
+typedef struct _EBoxPY_Filter_Operator_T {
+	const char* Token_;
+	unsigned long Operation_;
+} _EBoxPY_Filter_Operator;
+
+static int _EBoxPY_Filter_Binary(_PEBoxPY_Filter_Parser _Parser, const _EBoxPY_Filter_Operator* _Operators, int (*_Next)(_PEBoxPY_Filter_Parser), int _Repeat) {
+	if (!_Next(_Parser))
+		return 0;
+	for (;;) {
+		const _EBoxPY_Filter_Operator* found = NULL;
+		for (const _EBoxPY_Filter_Operator* i = _Operators; i->Token_ != NULL; ++i) {
+			if (_EBoxPY_Filter_Accept(_Parser, i->Token_)) {
+				found = i;
+				break;
+			}
+		}
+		if (!found)
+			return 1;
+		// and / or jump past their right operand once the left one decides the result.
+		int logical = (found->Operation_ == EBOXPY_FILTER_AND || found->Operation_ == EBOXPY_FILTER_OR);
+		unsigned long long jump = _Parser->Filter_->Length_;
+		if (logical && !_EBoxPY_Filter_Emit(_Parser, (found->Operation_ == EBOXPY_FILTER_AND ? EBOXPY_FILTER_JUMP_FALSE : EBOXPY_FILTER_JUMP_TRUE), 0, 0))
+			return 0;
+		if (!_Next(_Parser) || !_EBoxPY_Filter_Emit(_Parser, found->Operation_, 0, 0))
+			return 0;
+		if (logical)
+			_Parser->Filter_->Code_[jump].Value_ = _Parser->Filter_->Length_;
+		if (!_Repeat)
+			return 1;
+	}
+}
+
+static const _EBoxPY_Filter_Operator _EBoxPY_Filter_Products[] = {{"*", EBOXPY_FILTER_MULTIPLY}, {NULL}};
+static const _EBoxPY_Filter_Operator _EBoxPY_Filter_Sums[] = {{"+", EBOXPY_FILTER_ADD}, {"-", EBOXPY_FILTER_SUBTRACT}, {NULL}};
+static const _EBoxPY_Filter_Operator _EBoxPY_Filter_Bit_Ands[] = {{"&", EBOXPY_FILTER_BIT_AND}, {NULL}};
+static const _EBoxPY_Filter_Operator _EBoxPY_Filter_Bit_Xors[] = {{"^", EBOXPY_FILTER_BIT_XOR}, {NULL}};
+static const _EBoxPY_Filter_Operator _EBoxPY_Filter_Bit_Ors[] = {{"|", EBOXPY_FILTER_BIT_OR}, {NULL}};
+static const _EBoxPY_Filter_Operator _EBoxPY_Filter_Comparisons[] = {
+	{"==", EBOXPY_FILTER_EQUAL}, {"!=", EBOXPY_FILTER_NOT_EQUAL}, {"<=", EBOXPY_FILTER_LESS_EQUAL},
+	{">=", EBOXPY_FILTER_GREATER_EQUAL}, {"<", EBOXPY_FILTER_LESS}, {">", EBOXPY_FILTER_GREATER}, {NULL}
+};
+static const _EBoxPY_Filter_Operator _EBoxPY_Filter_Ands[] = {{"&&", EBOXPY_FILTER_AND}, {"and", EBOXPY_FILTER_AND}, {NULL}};
+static const _EBoxPY_Filter_Operator _EBoxPY_Filter_Ors[] = {{"||", EBOXPY_FILTER_OR}, {"or", EBOXPY_FILTER_OR}, {NULL}};
+
+static int _EBoxPY_Filter_Product(_PEBoxPY_Filter_Parser _Parser) {
+	return _EBoxPY_Filter_Binary(_Parser, _EBoxPY_Filter_Products, _EBoxPY_Filter_Unary, 1);
+}
+
+static int _EBoxPY_Filter_Sum(_PEBoxPY_Filter_Parser _Parser) {
+	return _EBoxPY_Filter_Binary(_Parser, _EBoxPY_Filter_Sums, _EBoxPY_Filter_Product, 1);
+}
+
+static int _EBoxPY_Filter_Bit_And(_PEBoxPY_Filter_Parser _Parser) {
+	return _EBoxPY_Filter_Binary(_Parser, _EBoxPY_Filter_Bit_Ands, _EBoxPY_Filter_Sum, 1);
+}
+
+static int _EBoxPY_Filter_Bit_Xor(_PEBoxPY_Filter_Parser _Parser) {
+	return _EBoxPY_Filter_Binary(_Parser, _EBoxPY_Filter_Bit_Xors, _EBoxPY_Filter_Bit_And, 1);
+}
+
+static int _EBoxPY_Filter_Bit_Or(_PEBoxPY_Filter_Parser _Parser) {
+	return _EBoxPY_Filter_Binary(_Parser, _EBoxPY_Filter_Bit_Ors, _EBoxPY_Filter_Bit_Xor, 1);
+}
+
+static int _EBoxPY_Filter_Comparison(_PEBoxPY_Filter_Parser _Parser) {
+	return _EBoxPY_Filter_Binary(_Parser, _EBoxPY_Filter_Comparisons, _EBoxPY_Filter_Bit_Or, 0);
+}
+
+static int _EBoxPY_Filter_And(_PEBoxPY_Filter_Parser _Parser) {
+	return _EBoxPY_Filter_Binary(_Parser, _EBoxPY_Filter_Ands, _EBoxPY_Filter_Comparison, 1);
+}
+
+static int _EBoxPY_Filter_Or(_PEBoxPY_Filter_Parser _Parser) {
+	return _EBoxPY_Filter_Binary(_Parser, _EBoxPY_Filter_Ors, _EBoxPY_Filter_And, 1);
+}
+
+static int _EBoxPY_Filter_Compile(const char* _Text, _PEBoxPY_Filter _Filter, const char** _Error) {
+	_EBoxPY_Filter_Parser parser = {_Text, _Filter, 0, NULL};
+	_Filter->Length_ = 0;
+	if (_EBoxPY_Filter_Or(&parser)) {
+		while (isspace((unsigned char)*parser.Text_))
+			++parser.Text_;
+		if (!*parser.Text_)
+			return 1;
+		parser.Error_ = "EBoxPY.Debugger.SetFilter _Expression had trailing characters.";
+	}
+	*_Error = parser.Error_;
+	return 0;
+}
+
+// A value computed from a failed memory read is unknown, and / or still decide on their other operand.
+// Returns 0 when the result itself is unknown, the hit is then treated as not matching.
+static int _EBoxPY_Filter_Evaluate(_PEBoxPY_Filter _Filter, HANDLE _Process, CONTEXT* _Context, unsigned long long* _Result) {
+	unsigned long long stack[EBOXPY_FILTER_DEPTH];
+	char unknown[EBOXPY_FILTER_DEPTH];
+	unsigned long long depth = 0;
+	for (unsigned long long i = 0; i < _Filter->Length_; ++i) {
+		_PEBoxPY_Filter_Instruction instruction = &_Filter->Code_[i];
+		unsigned long long value = 0;
+		switch (instruction->Operation_) {
+		case EBOXPY_FILTER_CONSTANT:
+			unknown[depth] = 0;
+			stack[depth++] = instruction->Value_;
+			continue;
+		case EBOXPY_FILTER_REGISTER:
+			memcpy(&value, (unsigned char*)_Context + instruction->Value_, instruction->Size_);
+			unknown[depth] = 0;
+			stack[depth++] = value;
+			continue;
+		case EBOXPY_FILTER_LOAD:
+			if (!unknown[depth - 1] && !ReadProcessMemory(_Process, (LPCVOID)stack[depth - 1], &value, instruction->Size_, NULL))
+				unknown[depth - 1] = 1;
+			stack[depth - 1] = value;
+			continue;
+		case EBOXPY_FILTER_NOT:
+			stack[depth - 1] = !stack[depth - 1];
+			continue;
+		case EBOXPY_FILTER_NEGATE:
+			stack[depth - 1] = 0 - stack[depth - 1];
+			continue;
+		case EBOXPY_FILTER_INVERT:
+			stack[depth - 1] = ~stack[depth - 1];
+			continue;
+		case EBOXPY_FILTER_JUMP_FALSE:
+		case EBOXPY_FILTER_JUMP_TRUE:
+			if (!unknown[depth - 1] && !stack[depth - 1] == (instruction->Operation_ == EBOXPY_FILTER_JUMP_FALSE)) {
+				stack[depth - 1] = (instruction->Operation_ == EBOXPY_FILTER_JUMP_TRUE);
+				i = instruction->Value_ - 1;
+			}
+			continue;
+		}
+		unsigned long long right = stack[--depth];
+		unsigned long long left = stack[depth - 1];
+		char failed = (char)(unknown[depth] | unknown[depth - 1]);
+		switch (instruction->Operation_) {
+		case EBOXPY_FILTER_ADD: value = left + right; break;
+		case EBOXPY_FILTER_SUBTRACT: value = left - right; break;
+		case EBOXPY_FILTER_MULTIPLY: value = left * right; break;
+		case EBOXPY_FILTER_BIT_AND: value = left & right; break;
+		case EBOXPY_FILTER_BIT_OR: value = left | right; break;
+		case EBOXPY_FILTER_BIT_XOR: value = left ^ right; break;
+		case EBOXPY_FILTER_EQUAL: value = left == right; break;
+		case EBOXPY_FILTER_NOT_EQUAL: value = left != right; break;
+		case EBOXPY_FILTER_LESS: value = left < right; break;
+		case EBOXPY_FILTER_LESS_EQUAL: value = left <= right; break;
+		case EBOXPY_FILTER_GREATER: value = left > right; break;
+		case EBOXPY_FILTER_GREATER_EQUAL: value = left >= right; break;
+		// The left operand did not decide the result, a known right operand that does wins over an unknown left one.
+		case EBOXPY_FILTER_AND:
+			value = left && right;
+			if (!unknown[depth] && !right)
+				failed = 0;
+			break;
+		case EBOXPY_FILTER_OR:
+			value = left || right;
+			if (!unknown[depth] && right)
+				failed = 0;
+			break;
+		}
+		stack[depth - 1] = value;
+		unknown[depth - 1] = failed;
+	}
+	if (depth && unknown[depth - 1])
+		return 0;
+	*_Result = (depth ? stack[depth - 1] : 1);
+	return 1;
+}
+
+// Counts the hit against its Breakpoint and decides whether it reaches the record buffer.
+static int _EBoxPY_Debugger_Match(PEBoxPY_Debugger _Debugger, unsigned long _Index, CONTEXT* _Context) {
+	InterlockedIncrement64(&_Debugger->Hits_);
+	if (_Index >= EBOXPY_DEBUGGER_BREAKPOINTS)
+		return 1;
+	_PEBoxPY_Filter filter = &_Debugger->Filters_[_Index];
+	AcquireSRWLockExclusive(&_Debugger->Lock_);
+	++filter->Hits_;
+	unsigned long long result = 1;
+	int matched = (!filter->Length_ || (_EBoxPY_Filter_Evaluate(filter, _Debugger->Target_, _Context, &result) && result));
+	if (matched && filter->Skip_) {
+		--filter->Skip_;
+		matched = 0;
+	}
+	if (matched)
+		++filter->Matches_;
+	ReleaseSRWLockExclusive(&_Debugger->Lock_);
+	return matched;
+}
+
+// Guards_ and Watchpoints_ are shared with Watch and Unwatch, callers hold Lock_.
+static unsigned long long _EBoxPY_Debugger_Find_Guard(PEBoxPY_Debugger _Debugger, unsigned long long _Page) {
+	unsigned long long low = 0;
+	unsigned long long high = _Debugger->GuardCount_;
+	while (low < high) {
+		unsigned long long middle = low + (high - low) / 2;
+		if (_Debugger->Guards_[middle].Page_ < _Page)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return low;
+}
+
+static _PEBoxPY_Guard _EBoxPY_Debugger_Get_Guard(PEBoxPY_Debugger _Debugger, unsigned long long _Page) {
+	unsigned long long index = _EBoxPY_Debugger_Find_Guard(_Debugger, _Page);
+	if (index < _Debugger->GuardCount_ && _Debugger->Guards_[index].Page_ == _Page)
+		return &_Debugger->Guards_[index];
+	return NULL;
+}
+
+static int _EBoxPY_Debugger_Guard_Page(PEBoxPY_Debugger _Debugger, HANDLE _Process, unsigned long long _Page) {
+	unsigned long long index = _EBoxPY_Debugger_Find_Guard(_Debugger, _Page);
+	if (index < _Debugger->GuardCount_ && _Debugger->Guards_[index].Page_ == _Page) {
+		++_Debugger->Guards_[index].Count_;
+		return 1;
+	}
+	MEMORY_BASIC_INFORMATION information;
+	if (!VirtualQueryEx(_Process, (LPCVOID)_Page, &information, sizeof(MEMORY_BASIC_INFORMATION)) || information.State != MEM_COMMIT)
+		return 0;
+	if (_Debugger->GuardCount_ == _Debugger->GuardCapacity_) {
+		unsigned long long capacity = (_Debugger->GuardCapacity_ ? _Debugger->GuardCapacity_ * 2 : 64);
+		_PEBoxPY_Guard guards = (_PEBoxPY_Guard)realloc(_Debugger->Guards_, (size_t)capacity * sizeof(_EBoxPY_Guard));
+		if (!guards)
+			return 0;
+		_Debugger->Guards_ = guards;
+		_Debugger->GuardCapacity_ = capacity;
+	}
+	DWORD old = 0;
+	if (!VirtualProtectEx(_Process, (LPVOID)_Page, EBOXPY_PAGE_SIZE, information.Protect | PAGE_GUARD, &old))
+		return 0;
+	memmove(&_Debugger->Guards_[index + 1], &_Debugger->Guards_[index], (size_t)(_Debugger->GuardCount_ - index) * sizeof(_EBoxPY_Guard));
+	_Debugger->Guards_[index].Page_ = _Page;
+	_Debugger->Guards_[index].Protect_ = information.Protect;
+	_Debugger->Guards_[index].Count_ = 1;
+	++_Debugger->GuardCount_;
+	return 1;
+}
+
+static void _EBoxPY_Debugger_Unguard_Page(PEBoxPY_Debugger _Debugger, HANDLE _Process, unsigned long long _Page) {
+	unsigned long long index = _EBoxPY_Debugger_Find_Guard(_Debugger, _Page);
+	if (index >= _Debugger->GuardCount_ || _Debugger->Guards_[index].Page_ != _Page)
+		return;
+	if (--_Debugger->Guards_[index].Count_)
+		return;
+	DWORD old = 0;
+	VirtualProtectEx(_Process, (LPVOID)_Page, EBOXPY_PAGE_SIZE, _Debugger->Guards_[index].Protect_, &old);
+	memmove(&_Debugger->Guards_[index], &_Debugger->Guards_[index + 1], (size_t)(_Debugger->GuardCount_ - index - 1) * sizeof(_EBoxPY_Guard));
+	--_Debugger->GuardCount_;
+}
+
+static void _EBoxPY_Debugger_Reach(PEBoxPY_Debugger _Debugger) {
+	unsigned long long reach = 0;
+	for (unsigned long long i = 0; i < _Debugger->WatchpointCount_; ++i) {
+		if (_Debugger->Watchpoints_[i].End_ > reach)
+			reach = _Debugger->Watchpoints_[i].End_;
+		_Debugger->Watchpoints_[i].Reach_ = reach;
+	}
+}
+
+// Guard page exceptions report 0 for a read, 1 for a write and 8 for an execute.
+static int _EBoxPY_Debugger_Condition(int _Condition, unsigned long long _Access) {
+	if (_Condition == EBOXPY_BREAK_WRITE)
+		return _Access == 1;
+	if (_Condition == EBOXPY_BREAK_EXECUTE)
+		return _Access == 8;
+	return 1;
+}
+
+// Returns the Handle_ of the first Watchpoint covering _Address for this kind of access, 0 if none does.
+static unsigned long long _EBoxPY_Debugger_Stab(PEBoxPY_Debugger _Debugger, unsigned long long _Address, unsigned long long _Access) {
+	unsigned long long low = 0;
+	unsigned long long high = _Debugger->WatchpointCount_;
+	while (low < high) {
+		unsigned long long middle = low + (high - low) / 2;
+		if (_Debugger->Watchpoints_[middle].Start_ <= _Address)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	while (low > 0 && _Debugger->Watchpoints_[low - 1].Reach_ > _Address) {
+		_PEBoxPY_Watchpoint watchpoint = &_Debugger->Watchpoints_[--low];
+		if (_Address < watchpoint->End_ && _EBoxPY_Debugger_Condition(watchpoint->Condition_, _Access))
+			return watchpoint->Handle_;
+	}
+	return 0;
+}
+
+// The guard is consumed by the access, the Thread single steps over it and the page is guarded again.
+static DWORD _EBoxPY_Debugger_Guard(PEBoxPY_Debugger _Debugger, DEBUG_EVENT* _Event) {
+	_PEBoxPY_Debugger_Thread thread = _EBoxPY_Debugger_Get_Thread(_Debugger, _Event->dwThreadId);
+	if (!thread || _Event->u.Exception.ExceptionRecord.NumberParameters < 2)
+		return DBG_EXCEPTION_NOT_HANDLED;
+	unsigned long long access = _Event->u.Exception.ExceptionRecord.ExceptionInformation[0];
+	unsigned long long address = _Event->u.Exception.ExceptionRecord.ExceptionInformation[1];
+	unsigned long long page = address & ~(unsigned long long)(EBOXPY_PAGE_SIZE - 1);
+	AcquireSRWLockExclusive(&_Debugger->Lock_);
+	int guarded = (_EBoxPY_Debugger_Get_Guard(_Debugger, page) != NULL);
+	unsigned long long handle = (guarded ? _EBoxPY_Debugger_Stab(_Debugger, address, access) : 0);
+	ReleaseSRWLockExclusive(&_Debugger->Lock_);
+	if (!guarded)
+		return DBG_EXCEPTION_NOT_HANDLED;
+	CONTEXT context;
+	context.ContextFlags = CONTEXT_CONTROL | CONTEXT_INTEGER | CONTEXT_DEBUG_REGISTERS;
+	if (!GetThreadContext(thread->Thread_, &context))
+		return DBG_CONTINUE;
+	if (handle && _EBoxPY_Debugger_Match(_Debugger, (unsigned long)handle, &context))
+		_EBoxPY_Debugger_Record(_Debugger, _Event->dwThreadId, (unsigned long)handle, address, &context);
+	context.EFlags |= EBOXPY_DEBUGGER_TRAP;
+	if (SetThreadContext(thread->Thread_, &context))
+		thread->Rearm_ = page;
+	return DBG_CONTINUE;
+}
+
+static void _EBoxPY_Debugger_Rearm(PEBoxPY_Debugger _Debugger, unsigned long long _Page) {
+	AcquireSRWLockExclusive(&_Debugger->Lock_);
+	_PEBoxPY_Guard guard = _EBoxPY_Debugger_Get_Guard(_Debugger, _Page);
+	if (guard) {
+		DWORD old = 0;
+		VirtualProtectEx(_Debugger->Target_, (LPVOID)_Page, EBOXPY_PAGE_SIZE, guard->Protect_ | PAGE_GUARD, &old);
+	}
+	ReleaseSRWLockExclusive(&_Debugger->Lock_);
+}
+
+// A Hardware Breakpoint shows up as a single step with the firing index set in DR6, a Watchpoint re-arm as one without.
+static DWORD _EBoxPY_Debugger_Single_Step(PEBoxPY_Debugger _Debugger, DEBUG_EVENT* _Event) {
+	_PEBoxPY_Debugger_Thread entry = _EBoxPY_Debugger_Get_Thread(_Debugger, _Event->dwThreadId);
+	if (!entry)
+		return DBG_EXCEPTION_NOT_HANDLED;
+	HANDLE thread = entry->Thread_;
+	CONTEXT context;
+	context.ContextFlags = CONTEXT_CONTROL | CONTEXT_INTEGER | CONTEXT_DEBUG_REGISTERS;
+	if (!GetThreadContext(thread, &context))
+		return DBG_EXCEPTION_NOT_HANDLED;
+	int rearmed = 0;
+	if (entry->Rearm_) {
+		_EBoxPY_Debugger_Rearm(_Debugger, entry->Rearm_);
+		entry->Rearm_ = 0;
+		context.EFlags &= ~EBOXPY_DEBUGGER_TRAP;
+		rearmed = 1;
+	}
+	unsigned long long status = context.Dr6 & 0xF;
+	if (!status) {
+		if (!rearmed)
+			return DBG_EXCEPTION_NOT_HANDLED;
+		SetThreadContext(thread, &context);
+		return DBG_CONTINUE;
+	}
+	unsigned long index = 0;
+	while (!(status & (1ull << index)))
+		++index;
+	unsigned long long address = (&context.Dr0)[index];
+	if (_EBoxPY_Debugger_Match(_Debugger, index, &context))
+		_EBoxPY_Debugger_Record(_Debugger, _Event->dwThreadId, index, address, &context);
+	context.Dr6 = 0;
+	// Execute Breakpoints fault before the instruction runs, RF lets it run once without firing again.
+	if (!((context.Dr7 >> (16 + 4 * index)) & 0b11))
+		context.EFlags |= EBOXPY_DEBUGGER_RESUME;
+	SetThreadContext(thread, &context);
+	return DBG_CONTINUE;
+}
+
+// New Threads start with clear debug registers, copy in whatever SetBreakpointAll has set.
+static void _EBoxPY_Debugger_Inherit(PEBoxPY_Debugger _Debugger, HANDLE _Thread) {
+	PEBoxPY_Process process = (PEBoxPY_Process)_Debugger->Process_;
+	_EBoxPY_Breakpoint breakpoints[4];
+	AcquireSRWLockExclusive(&process->BreakpointLock_);
+	memcpy(breakpoints, process->Breakpoints_, sizeof(breakpoints));
+	ReleaseSRWLockExclusive(&process->BreakpointLock_);
+	unsigned long mask = 0;
+	for (unsigned long i = 0; i < 4; ++i) {
+		if (breakpoints[i].Control_)
+			mask |= 1 << i;
+	}
+	if (mask)
+		_EBoxPY_Breakpoint_Apply(_Thread, breakpoints, mask);
+}
+
+static DWORD WINAPI _EBoxPY_Debugger_Routine(LPVOID _Parameter) {
+	PEBoxPY_Debugger debugger = (PEBoxPY_Debugger)_Parameter;
+	// WaitForDebugEvent only reports to the Thread that attached.
+	debugger->Attached_ = (DebugActiveProcess(debugger->ID_) != FALSE);
+	if (debugger->Attached_) {
+		DebugSetProcessKillOnExit(FALSE);
+		debugger->IsRunning_ = 1;
+	}
+	SetEvent(debugger->Ready_);
+	if (!debugger->Attached_)
+		return 0;
+	DEBUG_EVENT event;
+	int exited = 0;
+	while (!debugger->Stop_ && !exited) {
+		if (!WaitForDebugEvent(&event, 50))
+			continue;
+		DWORD status = DBG_CONTINUE;
+		switch (event.dwDebugEventCode) {
+		case CREATE_PROCESS_DEBUG_EVENT:
+			if (event.u.CreateProcessInfo.hFile)
+				CloseHandle(event.u.CreateProcessInfo.hFile);
+			debugger->Target_ = event.u.CreateProcessInfo.hProcess;
+			_EBoxPY_Debugger_Add_Thread(debugger, event.dwThreadId, event.u.CreateProcessInfo.hThread);
+			break;
+		case CREATE_THREAD_DEBUG_EVENT:
+			_EBoxPY_Debugger_Add_Thread(debugger, event.dwThreadId, event.u.CreateThread.hThread);
+			_EBoxPY_Debugger_Inherit(debugger, event.u.CreateThread.hThread);
+			break;
+		case EXIT_THREAD_DEBUG_EVENT:
+			_EBoxPY_Debugger_Remove_Thread(debugger, event.dwThreadId);
+			break;
+		case EXIT_PROCESS_DEBUG_EVENT:
+			exited = 1;
+			break;
+		case LOAD_DLL_DEBUG_EVENT:
+			if (event.u.LoadDll.hFile)
+				CloseHandle(event.u.LoadDll.hFile);
+			break;
+		case EXCEPTION_DEBUG_EVENT:
+			if (event.u.Exception.ExceptionRecord.ExceptionCode == EXCEPTION_SINGLE_STEP)
+				status = _EBoxPY_Debugger_Single_Step(debugger, &event);
+			else if (event.u.Exception.ExceptionRecord.ExceptionCode == EXCEPTION_GUARD_PAGE)
+				status = _EBoxPY_Debugger_Guard(debugger, &event);
+			else if (event.u.Exception.ExceptionRecord.ExceptionCode == EXCEPTION_BREAKPOINT && !debugger->Initial_)
+				debugger->Initial_ = 1;
+			else
+				status = DBG_EXCEPTION_NOT_HANDLED;
+			break;
+		}
+		ContinueDebugEvent(event.dwProcessId, event.dwThreadId, status);
+	}
+	if (!exited) {
+		// Without a debugger a guarded page would fault in the Process, put every page back first.
+		AcquireSRWLockExclusive(&debugger->Lock_);
+		for (unsigned long long i = 0; i < debugger->GuardCount_; ++i) {
+			DWORD old = 0;
+			VirtualProtectEx(debugger->Target_, (LPVOID)debugger->Guards_[i].Page_, EBOXPY_PAGE_SIZE, debugger->Guards_[i].Protect_, &old);
+		}
+		debugger->GuardCount_ = 0;
+		debugger->WatchpointCount_ = 0;
+		ReleaseSRWLockExclusive(&debugger->Lock_);
+		DebugActiveProcessStop(debugger->ID_);
+		// After a detach nobody else will Close the Handles the debug events handed out.
+		for (unsigned long long i = 0; i < debugger->ThreadCount_; ++i)
+			CloseHandle(debugger->Threads_[i].Thread_);
+		if (debugger->Target_)
+			CloseHandle(debugger->Target_);
+	}
+	debugger->Target_ = NULL;
+	debugger->ThreadCount_ = 0;
+	debugger->IsRunning_ = 0;
+	return 0;
+}
+
+static void _EBoxPY_Debugger_Stop(PEBoxPY_Debugger _Debugger) {
+	if (!_Debugger->Thread_)
+		return;
+	InterlockedExchange(&_Debugger->Stop_, 1);
+	Py_BEGIN_ALLOW_THREADS
+	WaitForSingleObject(_Debugger->Thread_, INFINITE);
+	Py_END_ALLOW_THREADS
+	CloseHandle(_Debugger->Thread_);
+	_Debugger->Thread_ = NULL;
+	_Debugger->IsRunning_ = 0;
+}
+
+static void EBoxPY_Debugger_dealloc(PyObject* self) {
+	PEBoxPY_Debugger debugger = (PEBoxPY_Debugger)self;
+	_EBoxPY_Debugger_Stop(debugger);
+	if (debugger->Ready_)
+		CloseHandle(debugger->Ready_);
+	free(debugger->Threads_);
+	free(debugger->Watchpoints_);
+	free(debugger->Guards_);
+	_EBoxPY_Ring_Free(&debugger->Ring_);
+	Py_XDECREF(debugger->Process_);
+	Py_XDECREF(debugger->Format_);
+	Py_TYPE(self)->tp_free(self);
+}
+
+static PyObject* EBoxPY_Debugger_repr(PyObject* self) {
+	PEBoxPY_Debugger debugger = (PEBoxPY_Debugger)self;
+	char buffer[128] = {0};
+	sprintf(buffer, "<EBoxPY.Debugger: (ID: %lu) (Hits: %lld) (IsRunning: %i)>", debugger->ID_, (long long)debugger->Hits_, (int)debugger->IsRunning_);
+	return PyUnicode_FromString(buffer);
+}
+
+static PyObject* EBoxPY_Debugger_Drain(PEBoxPY_Debugger self, PyObject* args) {
+	unsigned long long maximum = 0;
+	if (!PyArg_ParseTuple(args, "|K", &maximum))
+		return NULL;
+	unsigned long long count = _EBoxPY_Ring_Available(&self->Ring_);
+	if (maximum && count > maximum)
+		count = maximum;
+	PyObject* output = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)(count * self->RecordSize_));
+	if (!output)
+		return NULL;
+	_EBoxPY_Ring_Drain(&self->Ring_, (unsigned char*)PyBytes_AS_STRING(output), count);
+	return output;
+}
+
+static PyObject* EBoxPY_Debugger_Stop(PEBoxPY_Debugger self) {
+	_EBoxPY_Debugger_Stop(self);
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Debugger_SetFilter(PEBoxPY_Debugger self, PyObject* args) {
+	unsigned long index = 0;
+	const char* expression = NULL;
+	unsigned long long skip = 0;
+	if (!PyArg_ParseTuple(args, "k|zK", &index, &expression, &skip))
+		return NULL;
+	if (index >= EBOXPY_DEBUGGER_BREAKPOINTS) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Debugger Requires _Index >= 0 && _Index <= 3.");
+		return NULL;
+	}
+	_EBoxPY_Filter filter;
+	memset(&filter, 0, sizeof(_EBoxPY_Filter));
+	const char* error = NULL;
+	if (expression && !_EBoxPY_Filter_Compile(expression, &filter, &error)) {
+		PyErr_SetString(PyExc_RuntimeError, error);
+		return NULL;
+	}
+	filter.Skip_ = skip;
+	AcquireSRWLockExclusive(&self->Lock_);
+	memcpy(&self->Filters_[index], &filter, sizeof(_EBoxPY_Filter));
+	ReleaseSRWLockExclusive(&self->Lock_);
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Debugger_GetCounts(PEBoxPY_Debugger self) {
+	unsigned long long counts[EBOXPY_DEBUGGER_BREAKPOINTS][2];
+	AcquireSRWLockExclusive(&self->Lock_);
+	for (unsigned long i = 0; i < EBOXPY_DEBUGGER_BREAKPOINTS; ++i) {
+		counts[i][0] = self->Filters_[i].Hits_;
+		counts[i][1] = self->Filters_[i].Matches_;
+	}
+	ReleaseSRWLockExclusive(&self->Lock_);
+	PyObject* output = PyList_New(EBOXPY_DEBUGGER_BREAKPOINTS);
+	if (!output)
+		return NULL;
+	for (unsigned long i = 0; i < EBOXPY_DEBUGGER_BREAKPOINTS; ++i) {
+		PyObject* count = Py_BuildValue("(KK)", counts[i][0], counts[i][1]);
+		if (!count) {
+			Py_DECREF(output);
+			return NULL;
+		}
+		PyList_SET_ITEM(output, i, count);
+	}
+	return output;
+}
+
+static PyObject* EBoxPY_Debugger_Watch(PEBoxPY_Debugger self, PyObject* args) {
+	unsigned long long address = 0;
+	unsigned long long size = 0;
+	int condition = EBOXPY_BREAK_ACCESS;
+	if (!PyArg_ParseTuple(args, "KK|i", &address, &size, &condition))
+		return NULL;
+	PEBoxPY_Process process = (PEBoxPY_Process)self->Process_;
+	if (!self->IsRunning_ || !process->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Debugger.IsRunning_ was False.");
+		return NULL;
+	}
+	if (!size || address + size < address) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Debugger.Watch Requires _Size > 0.");
+		return NULL;
+	}
+	if (condition != EBOXPY_BREAK_ACCESS && condition != EBOXPY_BREAK_EXECUTE && condition != EBOXPY_BREAK_WRITE) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Debugger.Watch Requires _Condition to be EBoxPY.ACCESS, EXECUTE, WRITE");
+		return NULL;
+	}
+	unsigned long long first = address & ~(unsigned long long)(EBOXPY_PAGE_SIZE - 1);
+	unsigned long long last = (address + size - 1) & ~(unsigned long long)(EBOXPY_PAGE_SIZE - 1);
+	unsigned long long handle = 0;
+	AcquireSRWLockExclusive(&self->Lock_);
+	if (self->WatchpointCount_ == self->WatchpointCapacity_) {
+		unsigned long long capacity = (self->WatchpointCapacity_ ? self->WatchpointCapacity_ * 2 : 64);
+		_PEBoxPY_Watchpoint watchpoints = (_PEBoxPY_Watchpoint)realloc(self->Watchpoints_, (size_t)capacity * sizeof(_EBoxPY_Watchpoint));
+		if (watchpoints) {
+			self->Watchpoints_ = watchpoints;
+			self->WatchpointCapacity_ = capacity;
+		}
+	}
+	unsigned long long page = first;
+	if (self->WatchpointCount_ < self->WatchpointCapacity_) {
+		for (; page <= last; page += EBOXPY_PAGE_SIZE) {
+			if (!_EBoxPY_Debugger_Guard_Page(self, process->Process_, page))
+				break;
+		}
+	}
+	if (self->WatchpointCount_ < self->WatchpointCapacity_ && page > last) {
+		unsigned long long index = 0;
+		while (index < self->WatchpointCount_ && self->Watchpoints_[index].Start_ <= address)
+			++index;
+		memmove(&self->Watchpoints_[index + 1], &self->Watchpoints_[index], (size_t)(self->WatchpointCount_ - index) * sizeof(_EBoxPY_Watchpoint));
+		handle = EBOXPY_DEBUGGER_BREAKPOINTS + self->NextWatchpoint_++;
+		self->Watchpoints_[index].Start_ = address;
+		self->Watchpoints_[index].End_ = address + size;
+		self->Watchpoints_[index].Handle_ = handle;
+		self->Watchpoints_[index].Condition_ = condition;
+		++self->WatchpointCount_;
+		_EBoxPY_Debugger_Reach(self);
+	}
+	else {
+		for (unsigned long long i = first; i < page; i += EBOXPY_PAGE_SIZE)
+			_EBoxPY_Debugger_Unguard_Page(self, process->Process_, i);
+	}
+	ReleaseSRWLockExclusive(&self->Lock_);
+	if (!handle) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Debugger.Watch failed to Guard every page in the range.");
+		return NULL;
+	}
+	return PyLong_FromUnsignedLongLong(handle);
+}
+
+static PyObject* EBoxPY_Debugger_Unwatch(PEBoxPY_Debugger self, PyObject* handle) {
+	if (!PyLong_Check(handle)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Debugger Requires _Handle to be int.");
+		return NULL;
+	}
+	unsigned long long _handle = PyLong_AsUnsignedLongLong(handle);
+	if (PyErr_Occurred())
+		return NULL;
+	PEBoxPY_Process process = (PEBoxPY_Process)self->Process_;
+	int found = 0;
+	AcquireSRWLockExclusive(&self->Lock_);
+	for (unsigned long long i = 0; i < self->WatchpointCount_; ++i) {
+		if (self->Watchpoints_[i].Handle_ != _handle)
+			continue;
+		unsigned long long first = self->Watchpoints_[i].Start_ & ~(unsigned long long)(EBOXPY_PAGE_SIZE - 1);
+		unsigned long long last = (self->Watchpoints_[i].End_ - 1) & ~(unsigned long long)(EBOXPY_PAGE_SIZE - 1);
+		for (unsigned long long page = first; page <= last; page += EBOXPY_PAGE_SIZE)
+			_EBoxPY_Debugger_Unguard_Page(self, process->Process_, page);
+		memmove(&self->Watchpoints_[i], &self->Watchpoints_[i + 1], (size_t)(self->WatchpointCount_ - i - 1) * sizeof(_EBoxPY_Watchpoint));
+		--self->WatchpointCount_;
+		_EBoxPY_Debugger_Reach(self);
+		found = 1;
+		break;
+	}
+	ReleaseSRWLockExclusive(&self->Lock_);
+	if (!found) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Debugger.Unwatch was given an unknown _Handle.");
+		return NULL;
+	}
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+// Only the 8 byte INTEGER, CONTROL and DEBUG Registers can be recorded.
+static int _EBoxPY_Debugger_Parse_Registers(PEBoxPY_Debugger _Debugger, PyObject* _Registers) {
+	PyObject* registers = PySequence_Fast(_Registers, "EBoxPY.Process.Debug requires _Registers to be a sequence of Register names.");
+	if (!registers)
+		return 0;
+	Py_ssize_t length = PySequence_Fast_GET_SIZE(registers);
+	if (length > EBOXPY_DEBUGGER_REGISTERS) {
+		Py_DECREF(registers);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Debug was given too many _Registers.");
+		return 0;
+	}
+	for (Py_ssize_t i = 0; i < length; ++i) {
+		const char* name = PyUnicode_AsUTF8(PySequence_Fast_GET_ITEM(registers, i));
+		_PEBoxPY_Thread_Register found = NULL;
+		for (_PEBoxPY_Thread_Register j = _EBoxPY_Thread_Register_List; name && j->Public_ != NULL; ++j) {
+			if (j->Size_ == 8 && j->Class_ != EBOXPY_CONTEXT_FLOATING && !strcmp(j->Public_, name)) {
+				found = j;
+				break;
+			}
+		}
+		if (!found) {
+			Py_DECREF(registers);
+			PyErr_Clear();
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Debug was given an unknown or non 8 byte Register.");
+			return 0;
+		}
+		_Debugger->Registers_[_Debugger->RegisterCount_++] = found->Private_;
+	}
+	Py_DECREF(registers);
+	return 1;
+}
+
+static PyObject* EBoxPY_Process_Debug(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	PyObject* registers = NULL;
+	if (!PyArg_ParseTuple(args, "|O", &registers))
+		return NULL;
+	PyObject* output = EBoxPY_Debugger_Type.tp_alloc(&EBoxPY_Debugger_Type, 1);
+	if (!output)
+		return NULL;
+	EBOXPY_OBJECT_ZERO(EBoxPY_Debugger, output);
+	PEBoxPY_Debugger debugger = (PEBoxPY_Debugger)output;
+	Py_INCREF((PyObject*)self);
+	debugger->Process_ = (PyObject*)self;
+	debugger->ID_ = self->ID_;
+	InitializeSRWLock(&debugger->Lock_);
+	if (registers && registers != Py_None) {
+		if (!_EBoxPY_Debugger_Parse_Registers(debugger, registers)) {
+			Py_DECREF(output);
+			return NULL;
+		}
+	}
+	else {
+		debugger->Registers_[debugger->RegisterCount_++] = offsetof(CONTEXT, Rip);
+	}
+	debugger->Format_ = PyUnicode_FromFormat("<QQII%lluQ", debugger->RegisterCount_);
+	debugger->RecordSize_ = 24 + 8 * debugger->RegisterCount_;
+	if (!debugger->Format_ || !_EBoxPY_Ring_Create(&debugger->Ring_, debugger->RecordSize_, 0x10000)) {
+		Py_DECREF(output);
+		if (!PyErr_Occurred())
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Debug failed to Allocate the record buffer.");
+		return NULL;
+	}
+	debugger->Capacity_ = debugger->Ring_.Capacity_;
+	LARGE_INTEGER value;
+	QueryPerformanceFrequency(&value);
+	debugger->Frequency_ = value.QuadPart;
+	QueryPerformanceCounter(&value);
+	debugger->Start_ = value.QuadPart;
+	debugger->Ready_ = CreateEventW(NULL, TRUE, FALSE, NULL);
+	if (debugger->Ready_)
+		debugger->Thread_ = CreateThread(NULL, 0, _EBoxPY_Debugger_Routine, debugger, 0, NULL);
+	if (!debugger->Thread_) {
+		Py_DECREF(output);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Debug failed to Create the debug Thread.");
+		return NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+	WaitForSingleObject(debugger->Ready_, INFINITE);
+	Py_END_ALLOW_THREADS
+	if (!debugger->Attached_) {
+		Py_DECREF(output);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Debug failed to Attach, DebugActiveProcess failed.");
+		return NULL;
+	}
+	return output;
+}
+
+/*
+ *
+ * EBoxPY Profile
+ *
+ */
+
+#define EBOXPY_PROFILE_DEPTH 64
+
+// Identical stacks share one entry, Frame_ indexes the first of Depth_ addresses in Frames_, leaf first.
+typedef struct _EBoxPY_Profile_Stack_T {
+	unsigned long long Hash_;
+	unsigned long long Frame_;
+	unsigned long long Depth_;
+	unsigned long long Count_;
+} _EBoxPY_Profile_Stack, *_PEBoxPY_Profile_Stack;
+
+typedef struct _EBoxPY_Profile_T {
+	HANDLE Process_;
+	unsigned long ID_;
+	double Duration_;
+	unsigned long Hz_;
+	int Stacks_;
+	_PEBoxPY_Profile_Stack Table_;
+	unsigned long long TableCapacity_;
+	unsigned long long TableCount_;
+	unsigned long long* Frames_;
+	unsigned long long FrameCount_;
+	unsigned long long FrameCapacity_;
+	_PEBoxPY_Module_Range Modules_;
+	unsigned long long ModuleCount_;
+	HANDLE* Threads_;
+	unsigned long long ThreadCount_;
+} _EBoxPY_Profile, *_PEBoxPY_Profile;
+
+static void _EBoxPY_Profile_Close_Threads(_PEBoxPY_Profile _Profile) {
+	for (unsigned long long i = 0; i < _Profile->ThreadCount_; ++i)
+		CloseHandle(_Profile->Threads_[i]);
+	free(_Profile->Threads_);
+	_Profile->Threads_ = NULL;
+	_Profile->ThreadCount_ = 0;
+}
+
+static void _EBoxPY_Profile_Free(_PEBoxPY_Profile _Profile) {
+	_EBoxPY_Profile_Close_Threads(_Profile);
+	free(_Profile->Table_);
+	free(_Profile->Frames_);
+	free(_Profile->Modules_);
+}
+
+// Handles are opened once per refresh rather than once per sample.
+static void _EBoxPY_Profile_Open_Threads(_PEBoxPY_Profile _Profile) {
+	_EBoxPY_Profile_Close_Threads(_Profile);
+	_PEBoxPY_Thread_Record records = NULL;
+	unsigned long long count = 0;
+	if (!_EBoxPY_System_Threads(_Profile->ID_, &records, &count))
+		return;
+	_Profile->Threads_ = (HANDLE*)malloc(((size_t)count + 1) * sizeof(HANDLE));
+	for (unsigned long long i = 0; _Profile->Threads_ && i < count; ++i) {
+		// Profiling the own Process must never Suspend the sampling Thread.
+		if (records[i].ID_ == GetCurrentThreadId())
+			continue;
+		HANDLE thread = OpenThread(THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT, FALSE, (DWORD)records[i].ID_);
+		if (thread)
+			_Profile->Threads_[_Profile->ThreadCount_++] = thread;
+	}
+	free(records);
+}
+
+static int _EBoxPY_Profile_Grow(_PEBoxPY_Profile _Profile) {
+	unsigned long long capacity = (_Profile->TableCapacity_ ? _Profile->TableCapacity_ * 2 : 1024);
+	_PEBoxPY_Profile_Stack table = (_PEBoxPY_Profile_Stack)calloc((size_t)capacity, sizeof(_EBoxPY_Profile_Stack));
+	if (!table)
+		return 0;
+	for (unsigned long long i = 0; i < _Profile->TableCapacity_; ++i) {
+		if (!_Profile->Table_[i].Count_)
+			continue;
+		unsigned long long slot = _Profile->Table_[i].Hash_ & (capacity - 1);
+		while (table[slot].Count_)
+			slot = (slot + 1) & (capacity - 1);
+		table[slot] = _Profile->Table_[i];
+	}
+	free(_Profile->Table_);
+	_Profile->Table_ = table;
+	_Profile->TableCapacity_ = capacity;
+	return 1;
+}
+
+static void _EBoxPY_Profile_Add(_PEBoxPY_Profile _Profile, const unsigned long long* _Frames, unsigned long long _Depth) {
+	if (2 * (_Profile->TableCount_ + 1) > _Profile->TableCapacity_ && !_EBoxPY_Profile_Grow(_Profile))
+		return;
+	// FNV-1a over the addresses.
+	unsigned long long hash = 14695981039346656037ull;
+	for (unsigned long long i = 0; i < _Depth; ++i) {
+		hash ^= _Frames[i];
+		hash *= 1099511628211ull;
+	}
+	unsigned long long slot = hash & (_Profile->TableCapacity_ - 1);
+	for (; _Profile->Table_[slot].Count_; slot = (slot + 1) & (_Profile->TableCapacity_ - 1)) {
+		_PEBoxPY_Profile_Stack stack = &_Profile->Table_[slot];
+		if (stack->Hash_ == hash && stack->Depth_ == _Depth && !memcmp(&_Profile->Frames_[stack->Frame_], _Frames, (size_t)_Depth * sizeof(unsigned long long))) {
+			++stack->Count_;
+			return;
+		}
+	}
+	if (_Profile->FrameCount_ + _Depth > _Profile->FrameCapacity_) {
+		unsigned long long capacity = (_Profile->FrameCapacity_ ? _Profile->FrameCapacity_ * 2 : 4096);
+		while (capacity < _Profile->FrameCount_ + _Depth)
+			capacity *= 2;
+		unsigned long long* frames = (unsigned long long*)realloc(_Profile->Frames_, (size_t)capacity * sizeof(unsigned long long));
+		if (!frames)
+			return;
+		_Profile->Frames_ = frames;
+		_Profile->FrameCapacity_ = capacity;
+	}
+	memcpy(&_Profile->Frames_[_Profile->FrameCount_], _Frames, (size_t)_Depth * sizeof(unsigned long long));
+	_PEBoxPY_Profile_Stack stack = &_Profile->Table_[slot];
+	stack->Hash_ = hash;
+	stack->Frame_ = _Profile->FrameCount_;
+	stack->Depth_ = _Depth;
+	stack->Count_ = 1;
+	_Profile->FrameCount_ += _Depth;
+	++_Profile->TableCount_;
+}
+
+static void _EBoxPY_Profile_Sample(_PEBoxPY_Profile _Profile, HANDLE _Thread) {
+	if (SuspendThread(_Thread) == (DWORD)-1)
+		return;
+	CONTEXT context;
+	context.ContextFlags = CONTEXT_CONTROL | CONTEXT_INTEGER;
+	unsigned long long frames[EBOXPY_PROFILE_DEPTH];
+	unsigned long long depth = 0;
+	if (GetThreadContext(_Thread, &context)) {
+		frames[depth++] = context.Rip;
+		// Each frame is [saved RBP, return address], the chain must climb the stack.
+		unsigned long long frame = context.Rbp;
+		while (_Profile->Stacks_ && depth < EBOXPY_PROFILE_DEPTH && frame > context.Rsp && !(frame & 7)) {
+			unsigned long long pair[2];
+			if (!ReadProcessMemory(_Profile->Process_, (LPCVOID)frame, pair, sizeof(pair), NULL) || !pair[1])
+				break;
+			frames[depth++] = pair[1];
+			if (pair[0] <= frame)
+				break;
+			frame = pair[0];
+		}
+	}
+	ResumeThread(_Thread);
+	if (depth)
+		_EBoxPY_Profile_Add(_Profile, frames, depth);
+}
+
+// Runs without the GIL for the whole _Duration.
+static void _EBoxPY_Profile_Run(_PEBoxPY_Profile _Profile) {
+	HANDLE timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	if (!timer)
+		timer = CreateWaitableTimerExW(NULL, NULL, 0, TIMER_ALL_ACCESS);
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER start;
+	LARGE_INTEGER now;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&start);
+	double interval = (double)frequency.QuadPart / _Profile->Hz_;
+	long long end = start.QuadPart + (long long)(_Profile->Duration_ * (double)frequency.QuadPart);
+	unsigned long long tick = 0;
+	for (;;) {
+		// New Threads are picked up once a second.
+		if (tick % _Profile->Hz_ == 0)
+			_EBoxPY_Profile_Open_Threads(_Profile);
+		for (unsigned long long i = 0; i < _Profile->ThreadCount_; ++i)
+			_EBoxPY_Profile_Sample(_Profile, _Profile->Threads_[i]);
+		++tick;
+		QueryPerformanceCounter(&now);
+		if (now.QuadPart >= end)
+			break;
+		long long deadline = start.QuadPart + (long long)((double)tick * interval);
+		if (now.QuadPart >= deadline)
+			continue;
+		if (!timer) {
+			Sleep(0);
+			continue;
+		}
+		LARGE_INTEGER due;
+		due.QuadPart = -(long long)((double)(deadline - now.QuadPart) * 10000000.0 / (double)frequency.QuadPart);
+		if (due.QuadPart > -1)
+			due.QuadPart = -1;
+		SetWaitableTimer(timer, &due, 0, NULL, NULL, FALSE);
+		WaitForSingleObject(timer, INFINITE);
+	}
+	if (timer)
+		CloseHandle(timer);
+	_EBoxPY_Profile_Close_Threads(_Profile);
+	_EBoxPY_System_Modules(_Profile->ID_, &_Profile->Modules_, &_Profile->ModuleCount_);
+}
+
+// Names are built once per Module, the histogram and folded stacks only reference them.
+static PyObject* _EBoxPY_Profile_Frame(_PEBoxPY_Profile _Profile, PyObject* _Names, unsigned long long _Address, PyObject** _Key) {
+	_PEBoxPY_Module_Range module = _EBoxPY_Find_Module_Range(_Profile->Modules_, _Profile->ModuleCount_, _Address);
+	if (!module) {
+		*_Key = Py_BuildValue("(OK)", Py_None, _Address);
+		return PyUnicode_FromFormat("0x%llx", _Address);
+	}
+	PyObject* name = PyList_GET_ITEM(_Names, module - _Profile->Modules_);
+	*_Key = Py_BuildValue("(OK)", name, _Address - module->Address_);
+	return PyUnicode_FromFormat("%U+0x%llx", name, _Address - module->Address_);
+}
+
+static PyObject* _EBoxPY_Profile_Output(_PEBoxPY_Profile _Profile) {
+	PyObject* names = PyList_New((Py_ssize_t)_Profile->ModuleCount_);
+	PyObject* histogram = PyDict_New();
+	PyObject* lines = PyList_New(0);
+	PyObject* separator = PyUnicode_FromString(";");
+	if (!names || !histogram || !lines || !separator)
+		goto failed;
+	for (unsigned long long i = 0; i < _Profile->ModuleCount_; ++i) {
+		PyObject* name = PyUnicode_FromWideChar(_Profile->Modules_[i].Name_, -1);
+		if (!name)
+			goto failed;
+		PyList_SET_ITEM(names, (Py_ssize_t)i, name);
+	}
+	for (unsigned long long i = 0; i < _Profile->TableCapacity_; ++i) {
+		_PEBoxPY_Profile_Stack stack = &_Profile->Table_[i];
+		if (!stack->Count_)
+			continue;
+		PyObject* frames = PyList_New((Py_ssize_t)stack->Depth_);
+		if (!frames)
+			goto failed;
+		// Folded stacks run from the root to the leaf.
+		for (unsigned long long j = 0; j < stack->Depth_; ++j) {
+			PyObject* key = NULL;
+			PyObject* frame = _EBoxPY_Profile_Frame(_Profile, names, _Profile->Frames_[stack->Frame_ + j], &key);
+			if (!frame || !key) {
+				Py_XDECREF(frame);
+				Py_XDECREF(key);
+				Py_DECREF(frames);
+				goto failed;
+			}
+			PyList_SET_ITEM(frames, (Py_ssize_t)(stack->Depth_ - 1 - j), frame);
+			if (j == 0) {
+				PyObject* count = PyDict_GetItem(histogram, key);
+				PyObject* total = PyLong_FromUnsignedLongLong((count ? PyLong_AsUnsignedLongLong(count) : 0) + stack->Count_);
+				int status = (total && PyDict_SetItem(histogram, key, total) == 0);
+				Py_XDECREF(total);
+				if (!status) {
+					Py_DECREF(key);
+					Py_DECREF(frames);
+					goto failed;
+				}
+			}
+			Py_DECREF(key);
+		}
+		PyObject* joined = PyUnicode_Join(separator, frames);
+		Py_DECREF(frames);
+		PyObject* line = (joined ? PyUnicode_FromFormat("%U %llu", joined, stack->Count_) : NULL);
+		Py_XDECREF(joined);
+		if (!line || PyList_Append(lines, line) != 0) {
+			Py_XDECREF(line);
+			goto failed;
+		}
+		Py_DECREF(line);
+	}
+	PyObject* newline = PyUnicode_FromString("\n");
+	PyObject* folded = (newline ? PyUnicode_Join(newline, lines) : NULL);
+	Py_XDECREF(newline);
+	PyObject* output = (folded ? PyTuple_Pack(2, histogram, folded) : NULL);
+	Py_XDECREF(folded);
+	Py_DECREF(names);
+	Py_DECREF(histogram);
+	Py_DECREF(lines);
+	Py_DECREF(separator);
+	return output;
+failed:
+	Py_XDECREF(names);
+	Py_XDECREF(histogram);
+	Py_XDECREF(lines);
+	Py_XDECREF(separator);
+	return NULL;
+}
+
+static PyObject* EBoxPY_Process_Profile(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	double duration = 0.0;
+	unsigned long hz = 1000;
+	int stacks = 0;
+	if (!PyArg_ParseTuple(args, "d|kp", &duration, &hz, &stacks))
+		return NULL;
+	if (duration <= 0.0 || hz == 0 || hz > 10000) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Profile Requires _Duration > 0 and 0 < _Hz <= 10000.");
+		return NULL;
+	}
+	_EBoxPY_Profile profile;
+	memset(&profile, 0, sizeof(_EBoxPY_Profile));
+	profile.Process_ = self->Process_;
+	profile.ID_ = self->ID_;
+	profile.Duration_ = duration;
+	profile.Hz_ = hz;
+	profile.Stacks_ = stacks;
+	if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+	_EBoxPY_Profile_Run(&profile);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Process_Unpin((PyObject*)self);
+	PyObject* output = _EBoxPY_Profile_Output(&profile);
+	_EBoxPY_Profile_Free(&profile);
+	return output;
+}
+
+/*
+ *
+ * EBoxPY Unwind
+ *
+ */
+
+#define EBOXPY_WINDOW_SIZE 0x1000
+#define EBOXPY_UNWIND_CHAIN 32
+
+#define EBOXPY_UWOP_PUSH_NONVOL 0
+#define EBOXPY_UWOP_ALLOC_LARGE 1
+#define EBOXPY_UWOP_ALLOC_SMALL 2
+#define EBOXPY_UWOP_SET_FPREG 3
+#define EBOXPY_UWOP_SAVE_NONVOL 4
+#define EBOXPY_UWOP_SAVE_NONVOL_FAR 5
+#define EBOXPY_UWOP_EPILOG 6
+#define EBOXPY_UWOP_SPARE_CODE 7
+#define EBOXPY_UWOP_SAVE_XMM128 8
+#define EBOXPY_UWOP_SAVE_XMM128_FAR 9
+#define EBOXPY_UWOP_PUSH_MACHFRAME 10
+
+#define EBOXPY_UNW_FLAG_CHAININFO 0x4
+
+// Serves small remote reads from one larger read, stack slots and unwind codes sit close together.
+typedef struct _EBoxPY_Window_T {
+	HANDLE Process_;
+	unsigned long long Address_;
+	unsigned long long Size_;
+	unsigned char Data_[EBOXPY_WINDOW_SIZE];
+} _EBoxPY_Window, *_PEBoxPY_Window;
+
+static int _EBoxPY_Window_Read(_PEBoxPY_Window _Window, unsigned long long _Address, void* _Buffer, unsigned long long _Size) {
+	if (_Address >= _Window->Address_ && _Address + _Size <= _Window->Address_ + _Window->Size_) {
+		memcpy(_Buffer, _Window->Data_ + (_Address - _Window->Address_), (size_t)_Size);
+		return 1;
+	}
+	unsigned long long start = _Address & ~0xFull;
+	unsigned long long size = EBOXPY_WINDOW_SIZE;
+	// The window may run off the end of the readable Region, retry with the rest of the page.
+	if (!ReadProcessMemory(_Window->Process_, (LPCVOID)start, _Window->Data_, (SIZE_T)size, NULL)) {
+		size = EBOXPY_PAGE_SIZE - (start & (EBOXPY_PAGE_SIZE - 1));
+		if (!ReadProcessMemory(_Window->Process_, (LPCVOID)start, _Window->Data_, (SIZE_T)size, NULL)) {
+			_Window->Size_ = 0;
+			return 0;
+		}
+	}
+	_Window->Address_ = start;
+	_Window->Size_ = size;
+	if (_Address + _Size > start + size)
+		return ReadProcessMemory(_Window->Process_, (LPCVOID)_Address, _Buffer, (SIZE_T)_Size, NULL) != FALSE;
+	memcpy(_Buffer, _Window->Data_ + (_Address - start), (size_t)_Size);
+	return 1;
+}
+
+typedef struct _EBoxPY_Unwind_Module_T {
+	char Loaded_;
+	PRUNTIME_FUNCTION Functions_;
+	unsigned long long FunctionCount_;
+} _EBoxPY_Unwind_Module, *_PEBoxPY_Unwind_Module;
+
+#define EBOXPY_UNWIND_MISSES 256
+
+// Per Process cache of Module ranges and their .pdata, each table is read once on first use.
+// Misses_ holds pages outside every Module as of the last refresh, JIT frames then do not refresh on every call.
+typedef struct _EBoxPY_Unwind_T {
+	SRWLOCK Lock_;
+	_PEBoxPY_Module_Range Ranges_;
+	unsigned long long RangeCount_;
+	_PEBoxPY_Unwind_Module Modules_;
+	unsigned long long Misses_[EBOXPY_UNWIND_MISSES];
+	unsigned long long MissCount_;
+} _EBoxPY_Unwind, *_PEBoxPY_Unwind;
+
+static void _EBoxPY_Unwind_Clear(_PEBoxPY_Unwind _Unwind) {
+	for (unsigned long long i = 0; _Unwind->Modules_ && i < _Unwind->RangeCount_; ++i)
+		free(_Unwind->Modules_[i].Functions_);
+	free(_Unwind->Modules_);
+	free(_Unwind->Ranges_);
+	_Unwind->Modules_ = NULL;
+	_Unwind->Ranges_ = NULL;
+	_Unwind->RangeCount_ = 0;
+	memset(_Unwind->Misses_, 0, sizeof(_Unwind->Misses_));
+	_Unwind->MissCount_ = 0;
+}
+
+// Open addressing on the page number plus one, the table is emptied once half full.
+static int _EBoxPY_Unwind_Missed(_PEBoxPY_Unwind _Unwind, unsigned long long _Address, int _Add) {
+	unsigned long long page = (_Address >> 12) + 1;
+	unsigned long long slot = (page * 0x9E3779B97F4A7C15ULL) >> 56;
+	for (; _Unwind->Misses_[slot]; slot = (slot + 1) & (EBOXPY_UNWIND_MISSES - 1)) {
+		if (_Unwind->Misses_[slot] == page)
+			return 1;
+	}
+	if (!_Add)
+		return 0;
+	if (_Unwind->MissCount_ >= EBOXPY_UNWIND_MISSES / 2) {
+		memset(_Unwind->Misses_, 0, sizeof(_Unwind->Misses_));
+		_Unwind->MissCount_ = 0;
+		slot = (page * 0x9E3779B97F4A7C15ULL) >> 56;
+	}
+	_Unwind->Misses_[slot] = page;
+	++_Unwind->MissCount_;
+	return 0;
+}
+
+static void _EBoxPY_Unwind_Destroy(struct _EBoxPY_Unwind_T* _Unwind) {
+	if (!_Unwind)
+		return;
+	_EBoxPY_Unwind_Clear(_Unwind);
+	free(_Unwind);
+}
+
+static void _EBoxPY_Unwind_Refresh(_PEBoxPY_Unwind _Unwind, unsigned long _Process) {
+	_EBoxPY_Unwind_Clear(_Unwind);
+	_EBoxPY_System_Modules(_Process, &_Unwind->Ranges_, &_Unwind->RangeCount_);
+	_Unwind->Modules_ = (_PEBoxPY_Unwind_Module)calloc((size_t)_Unwind->RangeCount_ + 1, sizeof(_EBoxPY_Unwind_Module));
+	if (!_Unwind->Modules_)
+		_EBoxPY_Unwind_Clear(_Unwind);
+}
+
+// Reads the exception directory of a 64 bit Module in a single read, it is already sorted by BeginAddress.
+static void _EBoxPY_Unwind_Load(_PEBoxPY_Unwind _Unwind, HANDLE _Process, unsigned long long _Index) {
+	_PEBoxPY_Unwind_Module module = &_Unwind->Modules_[_Index];
+	unsigned long long base = _Unwind->Ranges_[_Index].Address_;
+	module->Loaded_ = 1;
+	IMAGE_DOS_HEADER dos;
+	IMAGE_NT_HEADERS64 headers;
+	if (!ReadProcessMemory(_Process, (LPCVOID)base, &dos, sizeof(IMAGE_DOS_HEADER), NULL) || dos.e_magic != IMAGE_DOS_SIGNATURE)
+		return;
+	if (!ReadProcessMemory(_Process, (LPCVOID)(base + dos.e_lfanew), &headers, sizeof(IMAGE_NT_HEADERS64), NULL) || headers.OptionalHeader.Magic != IMAGE_NT_OPTIONAL_HDR64_MAGIC)
+		return;
+	IMAGE_DATA_DIRECTORY directory = headers.OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXCEPTION];
+	unsigned long long count = directory.Size / sizeof(RUNTIME_FUNCTION);
+	if (!directory.VirtualAddress || !count)
+		return;
+	module->Functions_ = (PRUNTIME_FUNCTION)malloc((size_t)count * sizeof(RUNTIME_FUNCTION));
+	if (!module->Functions_)
+		return;
+	if (!ReadProcessMemory(_Process, (LPCVOID)(base + directory.VirtualAddress), module->Functions_, (SIZE_T)count * sizeof(RUNTIME_FUNCTION), NULL)) {
+		free(module->Functions_);
+		module->Functions_ = NULL;
+		return;
+	}
+	module->FunctionCount_ = count;
+}
+
+// Returns the Module index holding _Address or -1, filling _Function when it is covered by .pdata.
+static long long _EBoxPY_Unwind_Lookup(_PEBoxPY_Unwind _Unwind, HANDLE _Process, unsigned long long _Address, PRUNTIME_FUNCTION* _Function) {
+	*_Function = NULL;
+	_PEBoxPY_Module_Range range = _EBoxPY_Find_Module_Range(_Unwind->Ranges_, _Unwind->RangeCount_, _Address);
+	if (!range)
+		return -1;
+	unsigned long long index = (unsigned long long)(range - _Unwind->Ranges_);
+	_PEBoxPY_Unwind_Module module = &_Unwind->Modules_[index];
+	if (!module->Loaded_)
+		_EBoxPY_Unwind_Load(_Unwind, _Process, index);
+	unsigned long rva = (unsigned long)(_Address - range->Address_);
+	unsigned long long low = 0;
+	unsigned long long high = module->FunctionCount_;
+	while (low < high) {
+		unsigned long long middle = low + (high - low) / 2;
+		if (module->Functions_[middle].BeginAddress <= rva)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	if (low && rva < module->Functions_[low - 1].EndAddress)
+		*_Function = &module->Functions_[low - 1];
+	return (long long)index;
+}
+
+// Registers_ follows the unwind code numbering, RAX RCX RDX RBX RSP RBP RSI RDI R8 - R15.
+typedef struct _EBoxPY_Unwind_State_T {
+	unsigned long long Registers_[16];
+	unsigned long long Rip_;
+} _EBoxPY_Unwind_State, *_PEBoxPY_Unwind_State;
+
+// Returns how many extra slots follow the code of _Operation.
+static unsigned long _EBoxPY_Unwind_Slots(unsigned long _Operation, unsigned long _Information) {
+	switch (_Operation) {
+	case EBOXPY_UWOP_ALLOC_LARGE:
+		return (_Information == 0 ? 1 : 2);
+	case EBOXPY_UWOP_SAVE_NONVOL:
+	case EBOXPY_UWOP_EPILOG:
+	case EBOXPY_UWOP_SAVE_XMM128:
+		return 1;
+	case EBOXPY_UWOP_SAVE_NONVOL_FAR:
+	case EBOXPY_UWOP_SPARE_CODE:
+	case EBOXPY_UWOP_SAVE_XMM128_FAR:
+		return 2;
+	}
+	return 0;
+}
+
+static int _EBoxPY_Unwind_Codes(_PEBoxPY_Window _Code, _PEBoxPY_Window _Stack, _PEBoxPY_Unwind_State _State, unsigned long long _Base, const RUNTIME_FUNCTION* _Function, unsigned long long _Offset) {
+	unsigned long long* registers = _State->Registers_;
+	unsigned long rva = _Function->UnwindData;
+	int primary = 1;
+	int machine = 0;
+	for (int chain = 0; chain < EBOXPY_UNWIND_CHAIN; ++chain) {
+		unsigned char header[4];
+		unsigned short codes[256];
+		if (!_EBoxPY_Window_Read(_Code, _Base + rva, header, sizeof(header)))
+			return 0;
+		unsigned long count = header[2];
+		unsigned long frame_register = header[3] & 0xF;
+		unsigned long long frame_offset = (unsigned long long)(header[3] >> 4) * 16;
+		if (count && !_EBoxPY_Window_Read(_Code, _Base + rva + 4, codes, count * sizeof(unsigned short)))
+			return 0;
+		// Codes past _Offset belong to prolog instructions that have not run yet, chained entries always ran.
+		unsigned long long frame = registers[4];
+		for (unsigned long i = 0; frame_register && i < count; ++i) {
+			if (((codes[i] >> 8) & 0xF) == EBOXPY_UWOP_SET_FPREG && (!primary || _Offset >= (codes[i] & 0xFF)))
+				frame = registers[frame_register] - frame_offset;
+		}
+		for (unsigned long i = 0; i < count; ++i) {
+			unsigned long operation = (codes[i] >> 8) & 0xF;
+			unsigned long information = codes[i] >> 12;
+			int executed = (!primary || _Offset >= (codes[i] & 0xFF));
+			unsigned long long value = 0;
+			// A code whose slots run past CountOfCodes is malformed, the frame cannot be trusted.
+			if (i + _EBoxPY_Unwind_Slots(operation, information) >= count)
+				return 0;
+			switch (operation) {
+			case EBOXPY_UWOP_PUSH_NONVOL:
+				if (!executed)
+					break;
+				if (!_EBoxPY_Window_Read(_Stack, registers[4], &registers[information], 8))
+					return 0;
+				registers[4] += 8;
+				break;
+			case EBOXPY_UWOP_ALLOC_LARGE:
+				if (information == 0) {
+					value = (unsigned long long)codes[i + 1] * 8;
+					i += 1;
+				}
+				else {
+					value = (unsigned long long)codes[i + 1] | ((unsigned long long)codes[i + 2] << 16);
+					i += 2;
+				}
+				if (executed)
+					registers[4] += value;
+				break;
+			case EBOXPY_UWOP_ALLOC_SMALL:
+				if (executed)
+					registers[4] += (unsigned long long)information * 8 + 8;
+				break;
+			case EBOXPY_UWOP_SET_FPREG:
+				if (executed)
+					registers[4] = registers[frame_register] - frame_offset;
+				break;
+			case EBOXPY_UWOP_SAVE_NONVOL:
+				value = (unsigned long long)codes[++i] * 8;
+				if (executed && !_EBoxPY_Window_Read(_Stack, frame + value, &registers[information], 8))
+					return 0;
+				break;
+			case EBOXPY_UWOP_SAVE_NONVOL_FAR:
+				value = (unsigned long long)codes[i + 1] | ((unsigned long long)codes[i + 2] << 16);
+				i += 2;
+				if (executed && !_EBoxPY_Window_Read(_Stack, frame + value, &registers[information], 8))
+					return 0;
+				break;
+			case EBOXPY_UWOP_EPILOG:
+			case EBOXPY_UWOP_SAVE_XMM128:
+				i += 1;
+				break;
+			case EBOXPY_UWOP_SPARE_CODE:
+			case EBOXPY_UWOP_SAVE_XMM128_FAR:
+				i += 2;
+				break;
+			case EBOXPY_UWOP_PUSH_MACHFRAME:
+				if (!executed)
+					break;
+				registers[4] += (unsigned long long)information * 8;
+				if (!_EBoxPY_Window_Read(_Stack, registers[4], &_State->Rip_, 8) || !_EBoxPY_Window_Read(_Stack, registers[4] + 24, &value, 8))
+					return 0;
+				registers[4] = value;
+				machine = 1;
+				break;
+			}
+		}
+		if (!((header[0] >> 3) & EBOXPY_UNW_FLAG_CHAININFO))
+			break;
+		RUNTIME_FUNCTION chained;
+		if (!_EBoxPY_Window_Read(_Code, _Base + rva + 4 + ((count + 1) & ~1ul) * sizeof(unsigned short), &chained, sizeof(RUNTIME_FUNCTION)))
+			return 0;
+		rva = chained.UnwindData;
+		primary = 0;
+	}
+	if (machine)
+		return 1;
+	if (!_EBoxPY_Window_Read(_Stack, registers[4], &_State->Rip_, 8))
+		return 0;
+	registers[4] += 8;
+	return 1;
+}
+
+// Moves _State to the caller's frame, return addresses are looked up one byte back so calls ending a function resolve to it.
+static int _EBoxPY_Unwind_Step(_PEBoxPY_Unwind _Unwind, unsigned long _ID, HANDLE _Process, _PEBoxPY_Window _Code, _PEBoxPY_Window _Stack, _PEBoxPY_Unwind_State _State, int _Caller, int* _Refreshed) {
+	unsigned long long lookup = _State->Rip_ - (_Caller ? 1 : 0);
+	PRUNTIME_FUNCTION function = NULL;
+	long long index = _EBoxPY_Unwind_Lookup(_Unwind, _Process, lookup, &function);
+	if (index < 0 && !*_Refreshed && !_EBoxPY_Unwind_Missed(_Unwind, lookup, 0)) {
+		// A Module loaded since the cache was built.
+		*_Refreshed = 1;
+		_EBoxPY_Unwind_Refresh(_Unwind, _ID);
+		index = _EBoxPY_Unwind_Lookup(_Unwind, _Process, lookup, &function);
+	}
+	if (index < 0 && *_Refreshed)
+		_EBoxPY_Unwind_Missed(_Unwind, lookup, 1);
+	unsigned long long* registers = _State->Registers_;
+	if (function) {
+		unsigned long long base = _Unwind->Ranges_[index].Address_;
+		return _EBoxPY_Unwind_Codes(_Code, _Stack, _State, base, function, lookup - base - function->BeginAddress);
+	}
+	// Outside any Module the RBP chain is the only hint, inside one a missing entry means a leaf function.
+	if (index < 0 && registers[5] > registers[4] && !(registers[5] & 7)) {
+		unsigned long long pair[2];
+		if (!_EBoxPY_Window_Read(_Stack, registers[5], pair, sizeof(pair)))
+			return 0;
+		registers[4] = registers[5] + 16;
+		registers[5] = pair[0];
+		_State->Rip_ = pair[1];
+		return 1;
+	}
+	if (!_EBoxPY_Window_Read(_Stack, registers[4], &_State->Rip_, 8))
+		return 0;
+	registers[4] += 8;
+	return 1;
+}
+
+static PyObject* EBoxPY_Thread_GetStack(PEBoxPY_Thread self, PyObject* args) {
+	if (!self->IsLocked_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread.IsLocked_ was False.");
 		return NULL;
 	}
-	EBOXPY_OBJECT_ZERO(EBoxPY_Process, output);
-	PEBoxPY_Process process = (PEBoxPY_Process)output;
-	process->ID_ = (unsigned long)information.dwProcessId;
-	process->IsOpen_ = 1;
-	process->Process_ = information.hProcess;
-	process->Name_ = _EBoxPY_GetProcessNameFromID(process->ID_);
-	if (!process->Name_) {
-		Py_DECREF(thread);
-		Py_DECREF(output);
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.StartProcess Failed to Get Process Name from ID.");
+	if ((self->Classes_ & (EBOXPY_CONTEXT_INTEGER | EBOXPY_CONTEXT_CONTROL)) != (EBOXPY_CONTEXT_INTEGER | EBOXPY_CONTEXT_CONTROL)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread was not Locked with EBoxPY.INTEGER and CONTROL.");
 		return NULL;
 	}
-	return PyTuple_Pack(2, output, thread);
+	PyObject* _process = NULL;
+	unsigned long long maximum = 64;
+	if (!PyArg_ParseTuple(args, "O!|K", &EBoxPY_Process_Type, &_process, &maximum))
+		return NULL;
+	if (!maximum || maximum > 0x10000) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread.GetStack Requires 0 < _Maximum <= 65536.");
+		return NULL;
+	}
+	PEBoxPY_Process process = (PEBoxPY_Process)_process;
+	if (!process->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	if (process->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	if (GetProcessIdOfThread(self->Thread_) != process->ID_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread.GetStack Requires the Process owning the Thread.");
+		return NULL;
+	}
+	if (!process->Unwind_) {
+		process->Unwind_ = (_PEBoxPY_Unwind)calloc(1, sizeof(_EBoxPY_Unwind));
+		if (!process->Unwind_) {
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread.GetStack failed to Allocate the unwind cache.");
+			return NULL;
+		}
+		InitializeSRWLock(&process->Unwind_->Lock_);
+	}
+	unsigned long long* frames = (unsigned long long*)malloc(((size_t)maximum + 1) * sizeof(unsigned long long));
+	_PEBoxPY_Window windows = (_PEBoxPY_Window)calloc(2, sizeof(_EBoxPY_Window));
+	if (!frames || !windows) {
+		free(frames);
+		free(windows);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread.GetStack failed to Allocate frames.");
+		return NULL;
+	}
+	_EBoxPY_Unwind_State state;
+	const CONTEXT* context = &self->Save_;
+	unsigned long long registers[16] = {context->Rax, context->Rcx, context->Rdx, context->Rbx, context->Rsp, context->Rbp, context->Rsi, context->Rdi,
+		context->R8, context->R9, context->R10, context->R11, context->R12, context->R13, context->R14, context->R15};
+	memcpy(state.Registers_, registers, sizeof(registers));
+	state.Rip_ = context->Rip;
+	_PEBoxPY_Unwind unwind = process->Unwind_;
+	unsigned long long count = 0;
+	// Frames are resolved against a copy of the Module ranges so the unwind lock is dropped before the GIL is taken back.
+	long long* modules = NULL;
+	_PEBoxPY_Module_Range ranges = NULL;
+	if (!_EBoxPY_Process_Pin((PyObject*)process)) {
+		free(frames);
+		free(windows);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+	AcquireSRWLockExclusive(&unwind->Lock_);
+	windows[0].Process_ = process->Process_;
+	windows[1].Process_ = process->Process_;
+	int refreshed = 0;
+	if (!unwind->Modules_) {
+		refreshed = 1;
+		_EBoxPY_Unwind_Refresh(unwind, process->ID_);
+	}
+	while (count < maximum && state.Rip_) {
+		frames[count] = state.Rip_;
+		unsigned long long previous = state.Registers_[4];
+		if (!_EBoxPY_Unwind_Step(unwind, process->ID_, process->Process_, &windows[0], &windows[1], &state, count++ != 0, &refreshed))
+			break;
+		// The stack only grows back towards its base, anything else is a corrupt frame.
+		if (state.Registers_[4] <= previous)
+			break;
+	}
+	modules = (long long*)malloc(((size_t)count + 1) * sizeof(long long));
+	ranges = (_PEBoxPY_Module_Range)malloc(((size_t)unwind->RangeCount_ + 1) * sizeof(_EBoxPY_Module_Range));
+	if (modules && ranges) {
+		memcpy(ranges, unwind->Ranges_, (size_t)unwind->RangeCount_ * sizeof(_EBoxPY_Module_Range));
+		for (unsigned long long i = 0; i < count; ++i) {
+			_PEBoxPY_Module_Range range = _EBoxPY_Find_Module_Range(unwind->Ranges_, unwind->RangeCount_, frames[i]);
+			modules[i] = (range ? (long long)(range - unwind->Ranges_) : -1);
+		}
+	}
+	ReleaseSRWLockExclusive(&unwind->Lock_);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Process_Unpin((PyObject*)process);
+	free(windows);
+	if (!modules || !ranges) {
+		free(modules);
+		free(ranges);
+		free(frames);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Thread.GetStack failed to Allocate frames.");
+		return NULL;
+	}
+	PyObject* output = PyList_New((Py_ssize_t)count);
+	for (unsigned long long i = 0; output && i < count; ++i) {
+		PyObject* frame = NULL;
+		if (modules[i] >= 0) {
+			PyObject* name = PyUnicode_FromWideChar(ranges[modules[i]].Name_, -1);
+			if (name)
+				frame = Py_BuildValue("(KNK)", frames[i], name, frames[i] - ranges[modules[i]].Address_);
+		}
+		else {
+			frame = Py_BuildValue("(KOO)", frames[i], Py_None, Py_None);
+		}
+		if (!frame)
+			Py_CLEAR(output);
+		else
+			PyList_SET_ITEM(output, (Py_ssize_t)i, frame);
+	}
+	free(modules);
+	free(ranges);
+	free(frames);
+	return output;
 }
 
-static void EBoxPY_Process_dealloc(PyObject* self) {
-	PEBoxPY_Process process = (PEBoxPY_Process)self;
-	Py_XDECREF(process->Name_);
-	if (process->IsOpen_)
-		CloseHandle(process->Process_);
+/*
+ *
+ * EBoxPY.Spec
+ *
+ */
+
+PyDoc_STRVAR(EBoxPY_Spec__doc__, "EBoxPY Spec object, a compiled description of a remote linked list, tree or hash bucket chain for EBoxPY.Process.Traverse.\nEBoxPY.Spec(_Links, _Fields, _Maximum=65536, _Buckets=0), _Links are the offsets of the pointers to follow, _Fields are (Offset, Type) pairs to collect from every node.\nWith _Buckets > 0 the Traverse start is an array of _Buckets head pointers.");
+
+typedef struct _EBoxPY_Spec_Field_T {
+	unsigned long long Offset_;
+	unsigned long long Type_;
+	unsigned long long Size_;
+} _EBoxPY_Spec_Field, *_PEBoxPY_Spec_Field;
+
+typedef struct EBoxPY_Spec_T {
+	//
+	PyObject_HEAD
+	//
+	unsigned long long* Links_;
+	unsigned long long LinkCount_;
+	_PEBoxPY_Spec_Field Fields_;
+	unsigned long long FieldCount_;
+	unsigned long long NodeSize_;
+	unsigned long long Maximum_;
+	unsigned long long Buckets_;
+	PyObject* Formats_;
+	//
+	volatile LONG Busy_;
+	//
+} EBoxPY_Spec, *PEBoxPY_Spec;
+
+static int EBoxPY_Spec_init(PyObject* self, PyObject* args, PyObject* kwds);
+static PyObject* EBoxPY_Spec_new(PyTypeObject* type, PyObject* args, PyObject* kwds);
+static void EBoxPY_Spec_dealloc(PyObject* self);
+static PyObject* EBoxPY_Spec_repr(PyObject* self);
+
+static PyMemberDef EBoxPY_Spec_Members[] = {
+	{"NodeSize_", T_ULONGLONG, offsetof(EBoxPY_Spec, NodeSize_), READONLY, PyDoc_STR("The number of bytes Read from every node.")},
+	{"Maximum_", T_ULONGLONG, offsetof(EBoxPY_Spec, Maximum_), READONLY, PyDoc_STR("The most nodes a single Traverse visits.")},
+	{"Buckets_", T_ULONGLONG, offsetof(EBoxPY_Spec, Buckets_), READONLY, PyDoc_STR("The number of head pointers at the start, 0 when the start is a node.")},
+	{"Formats_", T_OBJECT, offsetof(EBoxPY_Spec, Formats_), READONLY, PyDoc_STR("The struct module format of each field column.")},
+	{NULL}
+};
+
+static PyTypeObject EBoxPY_Spec_Type = {
+	PyObject_HEAD_INIT(NULL)
+	.tp_name = "EBoxPY.Spec",
+	.tp_basicsize = sizeof(EBoxPY_Spec),
+	.tp_doc = EBoxPY_Spec__doc__,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_members = EBoxPY_Spec_Members,
+	.tp_dealloc = EBoxPY_Spec_dealloc,
+	.tp_repr = EBoxPY_Spec_repr,
+	.tp_str = EBoxPY_Spec_repr,
+	.tp_init = EBoxPY_Spec_init,
+	.tp_new = EBoxPY_Spec_new,
+};
+
+static int _EBoxPY_Initialize_Spec(PyObject* self) {
+	if (PyType_Ready(&EBoxPY_Spec_Type) < 0)
+		return 0;
+	PyModule_AddObject(self, "Spec", (PyObject*)&EBoxPY_Spec_Type);
+	return 1;
+}
+
+static const char* _EBoxPY_Spec_Format(unsigned long long _Type) {
+	static const char* formats[] = {"B", "b", "H", "h", "I", "i", "Q", "q", "f", "d"};
+	return (_Type <= EBOXPY_DOUBLE ? formats[_Type] : NULL);
+}
+
+static void _EBoxPY_Spec_Clear(PEBoxPY_Spec _Spec) {
+	free(_Spec->Links_);
+	free(_Spec->Fields_);
+	Py_CLEAR(_Spec->Formats_);
+	_Spec->Links_ = NULL;
+	_Spec->Fields_ = NULL;
+	_Spec->LinkCount_ = 0;
+	_Spec->FieldCount_ = 0;
+	_Spec->NodeSize_ = 0;
+}
+
+static int EBoxPY_Spec_init(PyObject* self, PyObject* args, PyObject* kwds) {
+	// Traverse reads the tables with the GIL released, they are built aside and only swapped in while no Traverse runs.
+	if (((PEBoxPY_Spec)self)->Busy_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Spec is being Traversed.");
+		return -1;
+	}
+	EBoxPY_Spec built;
+	memset(&built, 0, sizeof(EBoxPY_Spec));
+	PEBoxPY_Spec spec = &built;
+	PyObject* links = NULL;
+	PyObject* fields = NULL;
+	spec->Maximum_ = 65536;
+	spec->Buckets_ = 0;
+	if (!PyArg_ParseTuple(args, "OO|KK", &links, &fields, &spec->Maximum_, &spec->Buckets_))
+		return -1;
+	PyObject* _links = PySequence_Fast(links, "EBoxPY.Spec requires _Links to be a sequence of offsets.");
+	if (!_links)
+		return -1;
+	PyObject* _fields = PySequence_Fast(fields, "EBoxPY.Spec requires _Fields to be a sequence of (Offset, Type).");
+	if (!_fields) {
+		Py_DECREF(_links);
+		return -1;
+	}
+	spec->LinkCount_ = (unsigned long long)PySequence_Fast_GET_SIZE(_links);
+	spec->FieldCount_ = (unsigned long long)PySequence_Fast_GET_SIZE(_fields);
+	spec->Links_ = (unsigned long long*)calloc((size_t)spec->LinkCount_ + 1, sizeof(unsigned long long));
+	spec->Fields_ = (_PEBoxPY_Spec_Field)calloc((size_t)spec->FieldCount_ + 1, sizeof(_EBoxPY_Spec_Field));
+	spec->Formats_ = PyTuple_New((Py_ssize_t)spec->FieldCount_);
+	int status = (spec->Links_ && spec->Fields_ && spec->Formats_);
+	if (!status && !PyErr_Occurred())
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Spec failed to Allocate.");
+	for (unsigned long long i = 0; status && i < spec->LinkCount_; ++i) {
+		spec->Links_[i] = PyLong_AsUnsignedLongLong(PySequence_Fast_GET_ITEM(_links, (Py_ssize_t)i));
+		status = !PyErr_Occurred();
+		if (status && spec->Links_[i] + 8 > spec->NodeSize_)
+			spec->NodeSize_ = spec->Links_[i] + 8;
+	}
+	for (unsigned long long i = 0; status && i < spec->FieldCount_; ++i) {
+		_PEBoxPY_Spec_Field field = &spec->Fields_[i];
+		status = PyArg_ParseTuple(PySequence_Fast_GET_ITEM(_fields, (Py_ssize_t)i), "KK", &field->Offset_, &field->Type_);
+		if (!status)
+			break;
+		field->Size_ = _EBoxPY_GetNativeSize(field->Type_);
+		if (!field->Size_) {
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Spec was given an invalid field Type.");
+			status = 0;
+			break;
+		}
+		if (field->Offset_ + field->Size_ > spec->NodeSize_)
+			spec->NodeSize_ = field->Offset_ + field->Size_;
+		PyObject* format = PyUnicode_FromString(_EBoxPY_Spec_Format(field->Type_));
+		if (!format) {
+			status = 0;
+			break;
+		}
+		PyTuple_SET_ITEM(spec->Formats_, (Py_ssize_t)i, format);
+	}
+	Py_DECREF(_links);
+	Py_DECREF(_fields);
+	if (status && (!spec->LinkCount_ || !spec->Maximum_ || spec->Maximum_ > 0x4000000 || spec->NodeSize_ > 0x10000)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Spec Requires at least one Link, 0 < _Maximum <= 67108864 and nodes no larger than 65536 bytes.");
+		status = 0;
+	}
+	PEBoxPY_Spec target = (PEBoxPY_Spec)self;
+	if (status && target->Busy_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Spec is being Traversed.");
+		status = 0;
+	}
+	if (!status) {
+		_EBoxPY_Spec_Clear(spec);
+		return -1;
+	}
+	_EBoxPY_Spec_Clear(target);
+	target->Links_ = spec->Links_;
+	target->LinkCount_ = spec->LinkCount_;
+	target->Fields_ = spec->Fields_;
+	target->FieldCount_ = spec->FieldCount_;
+	target->NodeSize_ = spec->NodeSize_;
+	target->Maximum_ = spec->Maximum_;
+	target->Buckets_ = spec->Buckets_;
+	target->Formats_ = spec->Formats_;
+	return 0;
+}
+
+static PyObject* EBoxPY_Spec_new(PyTypeObject* type, PyObject* args, PyObject* kwds) {
+	return type->tp_alloc(type, 1);
+}
+
+static void EBoxPY_Spec_dealloc(PyObject* self) {
+	_EBoxPY_Spec_Clear((PEBoxPY_Spec)self);
 	Py_TYPE(self)->tp_free(self);
 }
 
-static PyObject* EBoxPY_Process_repr(PyObject* self) {
-	PEBoxPY_Process process = (PEBoxPY_Process)self;
-	PyObject* encoded = PyUnicode_AsEncodedString(process->Name_, "UTF-8", "strict");
-	if (!encoded)
-		return NULL;
-	char* name = PyBytes_AS_STRING(encoded);
-	char output[512];
-	sprintf(output, "<EBoxPY.Process: (%s)>", name);
-	Py_DECREF(encoded);
-	return PyUnicode_FromString(output);
+static PyObject* EBoxPY_Spec_repr(PyObject* self) {
+	PEBoxPY_Spec spec = (PEBoxPY_Spec)self;
+	char buffer[128] = {0};
+	sprintf(buffer, "<EBoxPY.Spec: (Links: %llu) (Fields: %llu) (NodeSize: %llu)>", spec->LinkCount_, spec->FieldCount_, spec->NodeSize_);
+	return PyUnicode_FromString(buffer);
 }
 
-static PyObject* EBoxPY_Process_Open(PEBoxPY_Process self) {
-	if (self->IsOpen_) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was already True.");
+#define EBOXPY_TRAVERSE_PARALLEL 256
+
+typedef struct _EBoxPY_Traverse_Read_T {
+	HANDLE Process_;
+	unsigned long long* Addresses_;
+	unsigned char* Data_;
+	char* Valid_;
+	unsigned long long Count_;
+	unsigned long long NodeSize_;
+} _EBoxPY_Traverse_Read, *_PEBoxPY_Traverse_Read;
+
+static DWORD WINAPI _EBoxPY_Traverse_Read_Routine(LPVOID _Parameter) {
+	_PEBoxPY_Traverse_Read read = (_PEBoxPY_Traverse_Read)_Parameter;
+	for (unsigned long long i = 0; i < read->Count_; ++i)
+		read->Valid_[i] = (char)(ReadProcessMemory(read->Process_, (LPCVOID)read->Addresses_[i], read->Data_ + i * read->NodeSize_, (SIZE_T)read->NodeSize_, NULL) != FALSE);
+	return 0;
+}
+
+typedef struct _EBoxPY_Traverse_T {
+	HANDLE Process_;
+	PEBoxPY_Spec Spec_;
+	unsigned long long* Addresses_;
+	unsigned char* Data_;
+	char* Valid_;
+	unsigned long long Count_;
+	unsigned long long* Visited_;
+	unsigned long long VisitedCount_;
+	unsigned long long VisitedCapacity_;
+} _EBoxPY_Traverse, *_PEBoxPY_Traverse;
+
+// Returns 0 when _Address was already visited, which is how cycles and shared nodes end the walk.
+static int _EBoxPY_Traverse_Visit(_PEBoxPY_Traverse _Traverse, unsigned long long _Address) {
+	// Unreadable nodes are visited but never kept, keep the table at most half full regardless.
+	if (2 * (_Traverse->VisitedCount_ + 1) > _Traverse->VisitedCapacity_)
+		return 0;
+	unsigned long long mask = _Traverse->VisitedCapacity_ - 1;
+	unsigned long long slot = (_Address * 0x9E3779B97F4A7C15ull) >> 20 & mask;
+	for (; _Traverse->Visited_[slot]; slot = (slot + 1) & mask) {
+		if (_Traverse->Visited_[slot] == _Address)
+			return 0;
+	}
+	_Traverse->Visited_[slot] = _Address;
+	++_Traverse->VisitedCount_;
+	return 1;
+}
+
+// Runs without the GIL, each level of the structure is Read in one batch split across Threads.
+static int _EBoxPY_Traverse_Run(_PEBoxPY_Traverse _Traverse, unsigned long long _Start) {
+	PEBoxPY_Spec spec = _Traverse->Spec_;
+	unsigned long long maximum = spec->Maximum_;
+	unsigned long long node = spec->NodeSize_;
+	unsigned long long capacity = 2;
+	while (capacity < 2 * maximum)
+		capacity <<= 1;
+	_Traverse->VisitedCapacity_ = capacity;
+	_Traverse->Visited_ = (unsigned long long*)calloc((size_t)capacity, sizeof(unsigned long long));
+	_Traverse->Addresses_ = (unsigned long long*)malloc((size_t)maximum * sizeof(unsigned long long));
+	_Traverse->Data_ = (unsigned char*)malloc((size_t)(maximum * node));
+	_Traverse->Valid_ = (char*)malloc((size_t)maximum);
+	unsigned long long* next = (unsigned long long*)malloc((size_t)maximum * sizeof(unsigned long long));
+	if (!_Traverse->Visited_ || !_Traverse->Addresses_ || !_Traverse->Data_ || !_Traverse->Valid_ || !next) {
+		free(next);
+		return 0;
+	}
+	unsigned long long pending = 0;
+	if (spec->Buckets_) {
+		unsigned long long* buckets = (unsigned long long*)malloc((size_t)spec->Buckets_ * sizeof(unsigned long long));
+		if (!buckets || !ReadProcessMemory(_Traverse->Process_, (LPCVOID)_Start, buckets, (SIZE_T)spec->Buckets_ * sizeof(unsigned long long), NULL)) {
+			free(buckets);
+			free(next);
+			return 0;
+		}
+		for (unsigned long long i = 0; i < spec->Buckets_ && pending < maximum; ++i) {
+			if (buckets[i] && _EBoxPY_Traverse_Visit(_Traverse, buckets[i]))
+				next[pending++] = buckets[i];
+		}
+		free(buckets);
+	}
+	else if (_Start) {
+		_EBoxPY_Traverse_Visit(_Traverse, _Start);
+		next[pending++] = _Start;
+	}
+	while (pending) {
+		unsigned long long base = _Traverse->Count_;
+		memcpy(&_Traverse->Addresses_[base], next, (size_t)pending * sizeof(unsigned long long));
+		_EBoxPY_Traverse_Read reads[EBOXPY_PARALLEL_MAXIMUM];
+		unsigned long count = (pending >= EBOXPY_TRAVERSE_PARALLEL ? _EBoxPY_Parallel_Count() : 1);
+		unsigned long long chunk = (pending + count - 1) / count;
+		for (unsigned long i = 0; i < count; ++i) {
+			unsigned long long start = (i * chunk < pending ? i * chunk : pending);
+			unsigned long long end = ((i + 1) * chunk < pending ? (i + 1) * chunk : pending);
+			reads[i].Process_ = _Traverse->Process_;
+			reads[i].Addresses_ = &_Traverse->Addresses_[base + start];
+			reads[i].Data_ = _Traverse->Data_ + (base + start) * node;
+			reads[i].Valid_ = &_Traverse->Valid_[base + start];
+			reads[i].Count_ = end - start;
+			reads[i].NodeSize_ = node;
+		}
+		_EBoxPY_Parallel(count, _EBoxPY_Traverse_Read_Routine, reads, sizeof(_EBoxPY_Traverse_Read));
+		// Unreadable nodes are dropped, the survivors are compacted in visit order.
+		unsigned long long kept = base;
+		for (unsigned long long i = base; i < base + pending; ++i) {
+			if (!_Traverse->Valid_[i])
+				continue;
+			if (kept != i) {
+				_Traverse->Addresses_[kept] = _Traverse->Addresses_[i];
+				memmove(_Traverse->Data_ + kept * node, _Traverse->Data_ + i * node, (size_t)node);
+			}
+			++kept;
+		}
+		_Traverse->Count_ = kept;
+		pending = 0;
+		for (unsigned long long i = base; i < kept; ++i) {
+			for (unsigned long long j = 0; j < spec->LinkCount_; ++j) {
+				unsigned long long link = *(unsigned long long*)(_Traverse->Data_ + i * node + spec->Links_[j]);
+				if (!link || _Traverse->Count_ + pending >= maximum)
+					continue;
+				if (_EBoxPY_Traverse_Visit(_Traverse, link))
+					next[pending++] = link;
+			}
+		}
+	}
+	free(next);
+	return 1;
+}
+
+static PyObject* EBoxPY_Process_Traverse(PEBoxPY_Process self, PyObject* args) {
+	if (!self->IsOpen_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
 		return NULL;
 	}
-	self->Process_ = OpenProcess(PROCESS_ALL_ACCESS, FALSE, (DWORD)self->ID_);
-	if (!self->Process_ || self->Process_ == INVALID_HANDLE_VALUE) {
-		self->Process_ = NULL;
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process failed to open Process, OpenProcess failed.");
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
+		return NULL;
+	}
+	unsigned long long start = 0;
+	PyObject* _spec = NULL;
+	if (!PyArg_ParseTuple(args, "KO!", &start, &EBoxPY_Spec_Type, &_spec))
+		return NULL;
+	PEBoxPY_Spec spec = (PEBoxPY_Spec)_spec;
+	if (!spec->Links_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Traverse was given an uninitialized EBoxPY.Spec.");
+		return NULL;
+	}
+	_EBoxPY_Traverse traverse;
+	memset(&traverse, 0, sizeof(_EBoxPY_Traverse));
+	traverse.Process_ = self->Process_;
+	traverse.Spec_ = spec;
+	if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
 		return NULL;
 	}
-	self->IsOpen_ = (char)1;
-	Py_INCREF(Py_None);
-	return Py_None;
+	Py_INCREF(_spec);
+	int status = 0;
+	InterlockedIncrement(&spec->Busy_);
+	Py_BEGIN_ALLOW_THREADS
+	status = _EBoxPY_Traverse_Run(&traverse, start);
+	Py_END_ALLOW_THREADS
+	InterlockedDecrement(&spec->Busy_);
+	_EBoxPY_Process_Unpin((PyObject*)self);
+	PyObject* output = NULL;
+	PyObject* addresses = NULL;
+	PyObject* columns = NULL;
+	if (!status) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Traverse failed to Allocate or to Read the bucket array.");
+		goto done;
+	}
+	addresses = PyBytes_FromStringAndSize((const char*)traverse.Addresses_, (Py_ssize_t)(traverse.Count_ * sizeof(unsigned long long)));
+	columns = PyList_New((Py_ssize_t)spec->FieldCount_);
+	if (!addresses || !columns)
+		goto done;
+	for (unsigned long long i = 0; i < spec->FieldCount_; ++i) {
+		_PEBoxPY_Spec_Field field = &spec->Fields_[i];
+		PyObject* column = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)(traverse.Count_ * field->Size_));
+		if (!column)
+			goto done;
+		char* data = PyBytes_AS_STRING(column);
+		for (unsigned long long j = 0; j < traverse.Count_; ++j)
+			memcpy(data + j * field->Size_, traverse.Data_ + j * spec->NodeSize_ + field->Offset_, (size_t)field->Size_);
+		PyList_SET_ITEM(columns, (Py_ssize_t)i, column);
+	}
+	output = PyTuple_Pack(2, addresses, columns);
+done:
+	Py_XDECREF(addresses);
+	Py_XDECREF(columns);
+	Py_DECREF(_spec);
+	free(traverse.Visited_);
+	free(traverse.Addresses_);
+	free(traverse.Data_);
+	free(traverse.Valid_);
+	return output;
+}
+
+/*
+ *
+ * EBoxPY Pointer Map
+ *
+ */
+
+#define EBOXPY_POINTER_CHUNK 0x100000
+#define EBOXPY_POINTER_DEPTH 16
+#define EBOXPY_POINTER_NODES 0x100000
+#define EBOXPY_POINTER_PARALLEL 64
+
+// A location in the Process holding a value that lands in readable memory, the map is sorted by Value_.
+typedef struct _EBoxPY_Pointer_T {
+	unsigned long long Value_;
+	unsigned long long Location_;
+} _EBoxPY_Pointer, *_PEBoxPY_Pointer;
+
+// Parent_ indexes the node this one points into, node 0 is the target itself.
+typedef struct _EBoxPY_Pointer_Node_T {
+	unsigned long long Address_;
+	unsigned long long Parent_;
+	unsigned long long Offset_;
+} _EBoxPY_Pointer_Node, *_PEBoxPY_Pointer_Node;
+
+typedef struct _EBoxPY_Pointer_Chunk_T {
+	unsigned long long Address_;
+	unsigned long long Size_;
+} _EBoxPY_Pointer_Chunk, *_PEBoxPY_Pointer_Chunk;
+
+typedef struct _EBoxPY_Pointer_Map_T {
+	HANDLE Process_;
+	unsigned long long Width_;
+	unsigned long long Depth_;
+	unsigned long long Offset_;
+	LONG64 Maximum_;
+	volatile LONG64 Found_;
+	_EBoxPY_Ranges Readable_;
+	_EBoxPY_Dump_Vector Chunks_;
+	volatile LONG64 Next_;
+	_PEBoxPY_Pointer Pointers_;
+	unsigned long long PointerCount_;
+	_PEBoxPY_Module_Range Modules_;
+	unsigned long long ModuleCount_;
+	_EBoxPY_Dump_Vector Nodes_;
+	unsigned long long* Visited_;
+	unsigned long long VisitedCapacity_;
+	HANDLE File_;
+} _EBoxPY_Pointer_Map, *_PEBoxPY_Pointer_Map;
+
+// Each Thread owns its output, the calling Thread merges them once every Thread has returned.
+typedef struct _EBoxPY_Pointer_Worker_T {
+	_PEBoxPY_Pointer_Map Map_;
+	_EBoxPY_Dump_Vector Pointers_;
+	_EBoxPY_Dump_Vector Nodes_;
+	char* Text_;
+	unsigned long long TextSize_;
+	unsigned long long TextCapacity_;
+	unsigned long long First_;
+	unsigned long long Last_;
+	int Expand_;
+	int Failed_;
+} _EBoxPY_Pointer_Worker, *_PEBoxPY_Pointer_Worker;
+
+static int _EBoxPY_Pointer_Compare(const void* _Left, const void* _Right) {
+	const _EBoxPY_Pointer* left = (const _EBoxPY_Pointer*)_Left;
+	const _EBoxPY_Pointer* right = (const _EBoxPY_Pointer*)_Right;
+	if (left->Value_ != right->Value_)
+		return (left->Value_ > right->Value_) - (left->Value_ < right->Value_);
+	return (left->Location_ > right->Location_) - (left->Location_ < right->Location_);
+}
+
+static int _EBoxPY_Pointer_Readable(_PEBoxPY_Pointer_Map _Map, unsigned long long _Value) {
+	unsigned long long low = 0;
+	unsigned long long high = _Map->Readable_.Count_;
+	while (low < high) {
+		unsigned long long middle = low + (high - low) / 2;
+		if (_Map->Readable_.Data_[2 * middle + 1] <= _Value)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return (low < _Map->Readable_.Count_ && _Map->Readable_.Data_[2 * low] <= _Value);
+}
+
+// Index of the first entry with Value_ >= _Value.
+static unsigned long long _EBoxPY_Pointer_Lower(_PEBoxPY_Pointer_Map _Map, unsigned long long _Value) {
+	unsigned long long low = 0;
+	unsigned long long high = _Map->PointerCount_;
+	while (low < high) {
+		unsigned long long middle = low + (high - low) / 2;
+		if (_Map->Pointers_[middle].Value_ < _Value)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return low;
+}
+
+static DWORD WINAPI _EBoxPY_Pointer_Scan_Routine(LPVOID _Parameter) {
+	_PEBoxPY_Pointer_Worker worker = (_PEBoxPY_Pointer_Worker)_Parameter;
+	_PEBoxPY_Pointer_Map map = worker->Map_;
+	unsigned char* buffer = (unsigned char*)malloc(EBOXPY_POINTER_CHUNK);
+	if (!buffer) {
+		worker->Failed_ = 1;
+		return 0;
+	}
+	unsigned long long low = map->Readable_.Data_[0];
+	unsigned long long high = map->Readable_.Data_[2 * map->Readable_.Count_ - 1];
+	// Chunks are handed out one at a time so a few large Regions do not stall a single Thread.
+	for (unsigned long long i = (unsigned long long)InterlockedIncrement64(&map->Next_) - 1; i < map->Chunks_.Count_ && !worker->Failed_; i = (unsigned long long)InterlockedIncrement64(&map->Next_) - 1) {
+		_PEBoxPY_Pointer_Chunk chunk = &((_PEBoxPY_Pointer_Chunk)map->Chunks_.Data_)[i];
+		SIZE_T read = 0;
+		ReadProcessMemory(map->Process_, (LPCVOID)chunk->Address_, buffer, (SIZE_T)chunk->Size_, &read);
+		for (unsigned long long j = 0; j + map->Width_ <= (unsigned long long)read; j += map->Width_) {
+			unsigned long long value = (map->Width_ == 8 ? *(unsigned long long*)(buffer + j) : *(unsigned int*)(buffer + j));
+			if (value < low || value >= high || !_EBoxPY_Pointer_Readable(map, value))
+				continue;
+			_PEBoxPY_Pointer pointer = (_PEBoxPY_Pointer)_EBoxPY_Dump_Vector_Add(&worker->Pointers_, sizeof(_EBoxPY_Pointer));
+			if (!pointer) {
+				worker->Failed_ = 1;
+				break;
+			}
+			pointer->Value_ = value;
+			pointer->Location_ = chunk->Address_ + j;
+		}
+	}
+	free(buffer);
+	return 0;
+}
+
+static int _EBoxPY_Pointer_Text(_PEBoxPY_Pointer_Worker _Worker, const char* _Text, unsigned long long _Size) {
+	if (_Worker->TextSize_ + _Size > _Worker->TextCapacity_) {
+		unsigned long long capacity = (_Worker->TextCapacity_ ? _Worker->TextCapacity_ * 2 : 0x10000);
+		while (capacity < _Worker->TextSize_ + _Size)
+			capacity *= 2;
+		char* text = (char*)realloc(_Worker->Text_, (size_t)capacity);
+		if (!text)
+			return 0;
+		_Worker->Text_ = text;
+		_Worker->TextCapacity_ = capacity;
+	}
+	memcpy(_Worker->Text_ + _Worker->TextSize_, _Text, (size_t)_Size);
+	_Worker->TextSize_ += _Size;
+	return 1;
+}
+
+// Module+Offset, then the Offset added after each dereference, ending at the target.
+static int _EBoxPY_Pointer_Emit(_PEBoxPY_Pointer_Worker _Worker, _PEBoxPY_Module_Range _Module, unsigned long long _Location, unsigned long long _Offset, unsigned long long _Node) {
+	_PEBoxPY_Pointer_Node nodes = (_PEBoxPY_Pointer_Node)_Worker->Map_->Nodes_.Data_;
+	char line[4 * (MAX_MODULE_NAME32 + 1) + 20 * (EBOXPY_POINTER_DEPTH + 2)];
+	int length = WideCharToMultiByte(CP_UTF8, 0, _Module->Name_, -1, line, 4 * (MAX_MODULE_NAME32 + 1), NULL, NULL);
+	length = (length > 0 ? length - 1 : 0);
+	length += sprintf(line + length, "+0x%llx,0x%llx", _Location - _Module->Address_, _Offset);
+	for (unsigned long long i = _Node; i; i = nodes[i].Parent_)
+		length += sprintf(line + length, ",0x%llx", nodes[i].Offset_);
+	line[length++] = '\n';
+	return _EBoxPY_Pointer_Text(_Worker, line, (unsigned long long)length);
+}
+
+static DWORD WINAPI _EBoxPY_Pointer_Search_Routine(LPVOID _Parameter) {
+	_PEBoxPY_Pointer_Worker worker = (_PEBoxPY_Pointer_Worker)_Parameter;
+	_PEBoxPY_Pointer_Map map = worker->Map_;
+	_PEBoxPY_Pointer_Node nodes = (_PEBoxPY_Pointer_Node)map->Nodes_.Data_;
+	for (unsigned long long i = worker->First_; i < worker->Last_ && !worker->Failed_; ++i) {
+		unsigned long long address = nodes[i].Address_;
+		unsigned long long low = (address > map->Offset_ ? address - map->Offset_ : 0);
+		for (unsigned long long j = _EBoxPY_Pointer_Lower(map, low); j < map->PointerCount_ && map->Pointers_[j].Value_ <= address; ++j) {
+			if (map->Found_ >= map->Maximum_)
+				return 0;
+			_PEBoxPY_Pointer pointer = &map->Pointers_[j];
+			_PEBoxPY_Module_Range module = _EBoxPY_Find_Module_Range(map->Modules_, map->ModuleCount_, pointer->Location_);
+			if (module) {
+				if (InterlockedIncrement64(&map->Found_) > map->Maximum_)
+					return 0;
+				if (!_EBoxPY_Pointer_Emit(worker, module, pointer->Location_, address - pointer->Value_, i)) {
+					worker->Failed_ = 1;
+					return 0;
+				}
+				continue;
+			}
+			if (!worker->Expand_)
+				continue;
+			_PEBoxPY_Pointer_Node node = (_PEBoxPY_Pointer_Node)_EBoxPY_Dump_Vector_Add(&worker->Nodes_, sizeof(_EBoxPY_Pointer_Node));
+			if (!node) {
+				worker->Failed_ = 1;
+				return 0;
+			}
+			node->Address_ = pointer->Location_;
+			node->Parent_ = i;
+			node->Offset_ = address - pointer->Value_;
+		}
+	}
+	return 0;
 }
 
-static PyObject* EBoxPY_Process_Close(PEBoxPY_Process self) {
-	if (!self->IsOpen_) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was already False.");
-		return NULL;
+// Returns 0 when _Address was already reached, every address is expanded once at its shallowest depth.
+static int _EBoxPY_Pointer_Visit(_PEBoxPY_Pointer_Map _Map, unsigned long long _Address) {
+	unsigned long long mask = _Map->VisitedCapacity_ - 1;
+	unsigned long long slot = (_Address * 0x9E3779B97F4A7C15ull) >> 20 & mask;
+	for (; _Map->Visited_[slot]; slot = (slot + 1) & mask) {
+		if (_Map->Visited_[slot] == _Address)
+			return 0;
 	}
-	CloseHandle(self->Process_);
-	self->Process_ = NULL;
-	self->IsOpen_ = (char)0;
-	Py_INCREF(Py_None);
-	return Py_None;
+	_Map->Visited_[slot] = _Address;
+	return 1;
 }
 
-static PyObject* EBoxPY_Process_GetModules(PEBoxPY_Process self) {
-	if (!self->IsOpen_) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
-		return NULL;
-	}
-	HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPMODULE | TH32CS_SNAPMODULE32, (DWORD)self->ID_);
-	if (!snapshot || snapshot == INVALID_HANDLE_VALUE) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.GetModules failed to Create Toolhelp32 Snapshot, CreateToolhelp32Snapshot failed.");
-		return NULL;
-	}
-	MODULEENTRY32W entry = {0};
-	entry.dwSize = sizeof(MODULEENTRY32W);
-	PyObject* dictionary = PyDict_New();
-	if (!dictionary) {
-		CloseHandle(snapshot);
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.GetModules failed to Create Dictionary.");
-		return NULL;
-	}
-	for (BOOL b = Module32FirstW(snapshot, &entry); b == TRUE; b = Module32NextW(snapshot, &entry)) {
-		PyObject* _module = _EBoxPY_Create_Module(self->Process_, entry);
-		if (_module) {
-			PyDict_SetItem(dictionary, ((PEBoxPY_Module)_module)->Name_, _module);
-			Py_DECREF(_module);
+static int _EBoxPY_Pointer_Build(_PEBoxPY_Pointer_Map _Map, PyObject* _Process, unsigned long _ID) {
+	MEMORY_BASIC_INFORMATION* information = NULL;
+	unsigned long long count = 0;
+	if (!_EBoxPY_Process_Collect_Regions(_Process, &information, &count))
+		return 0;
+	int failed = 0;
+	for (unsigned long long i = 0; i < count && !failed; ++i) {
+		if (information[i].State != MEM_COMMIT || !(information[i].Protect & EBOXPY_REGION_READABLE) || (information[i].Protect & PAGE_GUARD))
+			continue;
+		unsigned long long start = (unsigned long long)information[i].BaseAddress;
+		unsigned long long end = start + information[i].RegionSize;
+		_EBoxPY_Ranges_Add(&_Map->Readable_, start, end);
+		for (unsigned long long address = start; address < end && !failed; address += EBOXPY_POINTER_CHUNK) {
+			_PEBoxPY_Pointer_Chunk chunk = (_PEBoxPY_Pointer_Chunk)_EBoxPY_Dump_Vector_Add(&_Map->Chunks_, sizeof(_EBoxPY_Pointer_Chunk));
+			if (!chunk) {
+				failed = 1;
+				break;
+			}
+			chunk->Address_ = address;
+			chunk->Size_ = (end - address > EBOXPY_POINTER_CHUNK ? EBOXPY_POINTER_CHUNK : end - address);
 		}
 	}
-	CloseHandle(snapshot);
-	return dictionary;
+	free(information);
+	if (failed || _Map->Readable_.Failed_ || !_Map->Readable_.Count_)
+		return 0;
+	if (!_EBoxPY_System_Modules(_ID, &_Map->Modules_, &_Map->ModuleCount_))
+		return 0;
+	_EBoxPY_Pointer_Worker workers[EBOXPY_PARALLEL_MAXIMUM];
+	unsigned long threads = _EBoxPY_Parallel_Count();
+	memset(workers, 0, sizeof(workers));
+	for (unsigned long i = 0; i < threads; ++i)
+		workers[i].Map_ = _Map;
+	_EBoxPY_Parallel(threads, _EBoxPY_Pointer_Scan_Routine, workers, sizeof(_EBoxPY_Pointer_Worker));
+	int status = 1;
+	for (unsigned long i = 0; i < threads; ++i) {
+		status &= !workers[i].Failed_;
+		_Map->PointerCount_ += workers[i].Pointers_.Count_;
+	}
+	if (status)
+		_Map->Pointers_ = (_PEBoxPY_Pointer)malloc((size_t)(_Map->PointerCount_ + 1) * sizeof(_EBoxPY_Pointer));
+	unsigned long long offset = 0;
+	for (unsigned long i = 0; i < threads; ++i) {
+		if (_Map->Pointers_)
+			memcpy(&_Map->Pointers_[offset], workers[i].Pointers_.Data_, (size_t)workers[i].Pointers_.Count_ * sizeof(_EBoxPY_Pointer));
+		offset += workers[i].Pointers_.Count_;
+		free(workers[i].Pointers_.Data_);
+	}
+	if (!_Map->Pointers_)
+		return 0;
+	qsort(_Map->Pointers_, (size_t)_Map->PointerCount_, sizeof(_EBoxPY_Pointer), _EBoxPY_Pointer_Compare);
+	return 1;
 }
 
-static PyObject* EBoxPY_Process_GetRegion(PEBoxPY_Process self, PyObject* address) {
-	if (!PyLong_Check(address)) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.GetRegion requires _Address to be of type int.");
-		return NULL;
+// Runs without the GIL, builds the map then walks it backward from _Target one depth at a time.
+static int _EBoxPY_Pointer_Run(_PEBoxPY_Pointer_Map _Map, PyObject* _Process, unsigned long _ID, unsigned long long _Target, const wchar_t* _Path) {
+	if (!_EBoxPY_Pointer_Build(_Map, _Process, _ID))
+		return 0;
+	_Map->VisitedCapacity_ = 2 * EBOXPY_POINTER_NODES;
+	_Map->Visited_ = (unsigned long long*)calloc((size_t)_Map->VisitedCapacity_, sizeof(unsigned long long));
+	_PEBoxPY_Pointer_Node root = (_PEBoxPY_Pointer_Node)_EBoxPY_Dump_Vector_Add(&_Map->Nodes_, sizeof(_EBoxPY_Pointer_Node));
+	if (!_Map->Visited_ || !root)
+		return 0;
+	root->Address_ = _Target;
+	_EBoxPY_Pointer_Visit(_Map, _Target);
+	_Map->File_ = CreateFileW(_Path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (_Map->File_ == INVALID_HANDLE_VALUE) {
+		_Map->File_ = NULL;
+		return 0;
 	}
-	if (!self->IsOpen_) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
-		return NULL;
+	int status = 1;
+	unsigned long long first = 0;
+	for (unsigned long long depth = 0; depth < _Map->Depth_ && status && first < _Map->Nodes_.Count_ && _Map->Found_ < _Map->Maximum_; ++depth) {
+		unsigned long long last = _Map->Nodes_.Count_;
+		unsigned long long pending = last - first;
+		_EBoxPY_Pointer_Worker workers[EBOXPY_PARALLEL_MAXIMUM];
+		unsigned long threads = (pending >= EBOXPY_POINTER_PARALLEL ? _EBoxPY_Parallel_Count() : 1);
+		unsigned long long chunk = (pending + threads - 1) / threads;
+		memset(workers, 0, sizeof(workers));
+		for (unsigned long i = 0; i < threads; ++i) {
+			workers[i].Map_ = _Map;
+			workers[i].First_ = (first + i * chunk < last ? first + i * chunk : last);
+			workers[i].Last_ = (first + (i + 1) * chunk < last ? first + (i + 1) * chunk : last);
+			workers[i].Expand_ = (depth + 1 < _Map->Depth_);
+		}
+		_EBoxPY_Parallel(threads, _EBoxPY_Pointer_Search_Routine, workers, sizeof(_EBoxPY_Pointer_Worker));
+		// Paths are streamed to the file per depth, new nodes are deduplicated in a fixed order.
+		for (unsigned long i = 0; i < threads; ++i) {
+			DWORD written = 0;
+			status &= !workers[i].Failed_;
+			if (status && workers[i].TextSize_ && !WriteFile(_Map->File_, workers[i].Text_, (DWORD)workers[i].TextSize_, &written, NULL))
+				status = 0;
+			_PEBoxPY_Pointer_Node nodes = (_PEBoxPY_Pointer_Node)workers[i].Nodes_.Data_;
+			for (unsigned long long j = 0; status && j < workers[i].Nodes_.Count_ && _Map->Nodes_.Count_ < EBOXPY_POINTER_NODES; ++j) {
+				if (!_EBoxPY_Pointer_Visit(_Map, nodes[j].Address_))
+					continue;
+				_PEBoxPY_Pointer_Node node = (_PEBoxPY_Pointer_Node)_EBoxPY_Dump_Vector_Add(&_Map->Nodes_, sizeof(_EBoxPY_Pointer_Node));
+				if (!node)
+					status = 0;
+				else
+					*node = nodes[j];
+			}
+			free(workers[i].Text_);
+			free(workers[i].Nodes_.Data_);
+		}
+		first = last;
 	}
-	return _EBoxPY_Create_Region(self->Process_, PyLong_AsUnsignedLongLong(address));
+	return status;
 }
 
-/*
-static PyObject* EBoxPY_Process_Read(PEBoxPY_Process self, PyObject* args) {
+static void _EBoxPY_Pointer_Free(_PEBoxPY_Pointer_Map _Map) {
+	if (_Map->File_)
+		CloseHandle(_Map->File_);
+	_EBoxPY_Ranges_Free(&_Map->Readable_);
+	free(_Map->Chunks_.Data_);
+	free(_Map->Pointers_);
+	free(_Map->Modules_);
+	free(_Map->Nodes_.Data_);
+	free(_Map->Visited_);
+}
+
+static PyObject* EBoxPY_Process_FindPointerPaths(PEBoxPY_Process self, PyObject* args) {
 	if (!self->IsOpen_) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
 		return NULL;
 	}
-	if (PyTuple_Size(args) != 2) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Read requires 2 arguments.");
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
 		return NULL;
 	}
-	if (!PyLong_Check(PyTuple_GetItem(args, 0))) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Read requires _Address to be int.");
+	unsigned long long target = 0;
+	unsigned long long depth = 0;
+	unsigned long long offset = 0;
+	PyObject* path = NULL;
+	unsigned long long maximum = 1000000;
+	if (!PyArg_ParseTuple(args, "KKKO|K", &target, &depth, &offset, &path, &maximum))
 		return NULL;
-	}
-	if (!PyLong_Check(PyTuple_GetItem(args, 1))) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Read requires _Type to be int.");
+	if (!PyUnicode_Check(path)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.FindPointerPaths requires _Path to be str.");
 		return NULL;
 	}
-	unsigned long long address = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 0));
-	if (PyErr_Occurred()) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Read requires a valid int _Address.");
+	if (!depth || depth > EBOXPY_POINTER_DEPTH) {
+		PyErr_Format(PyExc_RuntimeError, "EBoxPY.Process.FindPointerPaths Requires 0 < _Depth <= %d.", EBOXPY_POINTER_DEPTH);
 		return NULL;
 	}
-	unsigned long long size = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 1));
-	if (PyErr_Occurred()) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Read requires a valid int _Size.");
+	BOOL wow64 = FALSE;
+	if (!IsWow64Process(self->Process_, &wow64)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process Failed to determine if Process is Wow64.");
 		return NULL;
 	}
-	PyObject* output = _EBoxPY_Create_Bytes(size);
-	if (!output) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Read failed to create Bytes.");
+	wchar_t* _path = PyUnicode_AsWideCharString(path, NULL);
+	if (!_path)
+		return NULL;
+	_EBoxPY_Pointer_Map map;
+	memset(&map, 0, sizeof(_EBoxPY_Pointer_Map));
+	map.Process_ = self->Process_;
+	map.Width_ = (wow64 ? 4 : 8);
+	map.Depth_ = depth;
+	map.Offset_ = offset;
+	map.Maximum_ = (LONG64)(maximum > 0x7FFFFFFFFFFFFFFFull ? 0x7FFFFFFFFFFFFFFFull : maximum);
+	int status = 0;
+	if (!_EBoxPY_Process_Pin((PyObject*)self)) {
+		PyMem_Free(_path);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
 		return NULL;
 	}
-	PyObject* _args = PyTuple_Pack(2, PyTuple_GetItem(args, 0), output);
-	PyObject* result = EBoxPY_Process_ReadTo(self, _args);
-	Py_DECREF(_args);
-	if (!result) {
-		Py_DECREF(output);
+	Py_BEGIN_ALLOW_THREADS
+	status = _EBoxPY_Pointer_Run(&map, (PyObject*)self, self->ID_, target, _path);
+	_EBoxPY_Pointer_Free(&map);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Process_Unpin((PyObject*)self);
+	PyMem_Free(_path);
+	if (!status) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.FindPointerPaths failed to Allocate, to Read the Regions or to Write _Path.");
 		return NULL;
 	}
-	else {
-		Py_DECREF(result);
-		return output;
+	return PyLong_FromUnsignedLongLong((unsigned long long)(map.Found_ < map.Maximum_ ? map.Found_ : map.Maximum_));
+}
+
+/*
+ *
+ * EBoxPY.Stream
+ *
+ */
+
+PyDoc_STRVAR(EBoxPY_Stream__doc__, "EBoxPY Stream object, a seekable read-only file over a range of Process memory, registered as an io.RawIOBase.\nSequential Reads double the native read-ahead up to 1 MB, a seek elsewhere resets it, unreadable pages Read as zeros.");
+
+#define EBOXPY_STREAM_MINIMUM 0x1000
+#define EBOXPY_STREAM_MAXIMUM 0x100000
+#define EBOXPY_STREAM_LINE 0x100
+
+typedef struct EBoxPY_Stream_T {
+	//
+	PyObject_HEAD
+	//
+	PyObject* Process_;
+	unsigned long long Address_;
+	unsigned long long Size_;
+	unsigned long long Position_;
+	unsigned long long Window_;
+	unsigned long long Reads_;
+	unsigned long long Zeroed_;
+	char IsClosed_;
+	char IsBusy_;
+	//
+	unsigned char* Buffer_;
+	unsigned long long BufferStart_;
+	unsigned long long BufferSize_;
+	unsigned long long Next_;
+	//
+} EBoxPY_Stream, *PEBoxPY_Stream;
+
+static void EBoxPY_Stream_dealloc(PyObject* self);
+static PyObject* EBoxPY_Stream_repr(PyObject* self);
+
+static PyObject* EBoxPY_Stream_readinto(PEBoxPY_Stream self, PyObject* buffer);
+static PyObject* EBoxPY_Stream_read(PEBoxPY_Stream self, PyObject* args);
+static PyObject* EBoxPY_Stream_readall(PEBoxPY_Stream self);
+static PyObject* EBoxPY_Stream_readline(PEBoxPY_Stream self, PyObject* args);
+static PyObject* EBoxPY_Stream_readlines(PEBoxPY_Stream self, PyObject* args);
+static PyObject* EBoxPY_Stream_iter(PyObject* self);
+static PyObject* EBoxPY_Stream_next(PyObject* self);
+static PyObject* EBoxPY_Stream_seek(PEBoxPY_Stream self, PyObject* args);
+static PyObject* EBoxPY_Stream_tell(PEBoxPY_Stream self);
+static PyObject* EBoxPY_Stream_readable(PEBoxPY_Stream self);
+static PyObject* EBoxPY_Stream_seekable(PEBoxPY_Stream self);
+static PyObject* EBoxPY_Stream_writable(PEBoxPY_Stream self);
+static PyObject* EBoxPY_Stream_flush(PEBoxPY_Stream self);
+static PyObject* EBoxPY_Stream_isatty(PEBoxPY_Stream self);
+static PyObject* EBoxPY_Stream_fileno(PEBoxPY_Stream self);
+static PyObject* EBoxPY_Stream_close(PEBoxPY_Stream self);
+static PyObject* EBoxPY_Stream_enter(PEBoxPY_Stream self);
+static PyObject* EBoxPY_Stream_exit(PEBoxPY_Stream self, PyObject* args);
+
+static PyMemberDef EBoxPY_Stream_Members[] = {
+	{"Process_", T_OBJECT, offsetof(EBoxPY_Stream, Process_), READONLY, PyDoc_STR("The Process being Read.")},
+	{"Address_", T_ULONGLONG, offsetof(EBoxPY_Stream, Address_), READONLY, PyDoc_STR("The Address of offset 0.")},
+	{"Size_", T_ULONGLONG, offsetof(EBoxPY_Stream, Size_), READONLY, PyDoc_STR("The Size of the Stream.")},
+	{"Window_", T_ULONGLONG, offsetof(EBoxPY_Stream, Window_), READONLY, PyDoc_STR("The current read-ahead Size.")},
+	{"Reads_", T_ULONGLONG, offsetof(EBoxPY_Stream, Reads_), READONLY, PyDoc_STR("The number of native Reads issued.")},
+	{"Zeroed_", T_ULONGLONG, offsetof(EBoxPY_Stream, Zeroed_), READONLY, PyDoc_STR("The number of unreadable pages Read as zeros.")},
+	{"IsClosed_", T_BOOL, offsetof(EBoxPY_Stream, IsClosed_), READONLY, PyDoc_STR("True once the Stream is closed.")},
+	{"closed", T_BOOL, offsetof(EBoxPY_Stream, IsClosed_), READONLY, PyDoc_STR("io.RawIOBase.closed, same as IsClosed_.")},
+	{NULL}
+};
+
+static PyMethodDef EBoxPY_Stream_Methods[] = {
+	{"readinto", (PyCFunction)EBoxPY_Stream_readinto, METH_O, PyDoc_STR("EBoxPY.Stream.readinto(_Buffer) -> int\nReads into a writable buffer or an EBoxPY.Bytes, returns the number of bytes Read, 0 at the end.")},
+	{"read", (PyCFunction)EBoxPY_Stream_read, METH_VARARGS, PyDoc_STR("EBoxPY.Stream.read(_Size=-1) -> bytes\nReads up to _Size bytes, or to the end when negative.")},
+	{"readall", (PyCFunction)EBoxPY_Stream_readall, METH_NOARGS, PyDoc_STR("EBoxPY.Stream.readall() -> bytes\nReads to the end.")},
+	{"readline", (PyCFunction)EBoxPY_Stream_readline, METH_VARARGS, PyDoc_STR("EBoxPY.Stream.readline(_Size=-1) -> bytes\nReads up to and including the next b'\\n', at most _Size bytes when _Size is not negative.")},
+	{"readlines", (PyCFunction)EBoxPY_Stream_readlines, METH_VARARGS, PyDoc_STR("EBoxPY.Stream.readlines(_Hint=-1) -> [ bytes, ... ]\nReads lines to the end, stops once _Hint bytes were Read when _Hint is positive.")},
+	{"seek", (PyCFunction)EBoxPY_Stream_seek, METH_VARARGS, PyDoc_STR("EBoxPY.Stream.seek(_Offset, _Whence=0) -> int\nMoves the position relative to the start, the current position or the end, returns the new position.")},
+	{"tell", (PyCFunction)EBoxPY_Stream_tell, METH_NOARGS, PyDoc_STR("EBoxPY.Stream.tell() -> int\nReturns the current position.")},
+	{"readable", (PyCFunction)EBoxPY_Stream_readable, METH_NOARGS, PyDoc_STR("EBoxPY.Stream.readable() -> bool\nAlways True.")},
+	{"seekable", (PyCFunction)EBoxPY_Stream_seekable, METH_NOARGS, PyDoc_STR("EBoxPY.Stream.seekable() -> bool\nAlways True.")},
+	{"writable", (PyCFunction)EBoxPY_Stream_writable, METH_NOARGS, PyDoc_STR("EBoxPY.Stream.writable() -> bool\nAlways False.")},
+	{"flush", (PyCFunction)EBoxPY_Stream_flush, METH_NOARGS, PyDoc_STR("EBoxPY.Stream.flush()\nDoes nothing, the Stream is read-only.")},
+	{"isatty", (PyCFunction)EBoxPY_Stream_isatty, METH_NOARGS, PyDoc_STR("EBoxPY.Stream.isatty() -> bool\nAlways False.")},
+	{"fileno", (PyCFunction)EBoxPY_Stream_fileno, METH_NOARGS, PyDoc_STR("EBoxPY.Stream.fileno()\nRaises io.UnsupportedOperation, the Stream has no file descriptor.")},
+	{"close", (PyCFunction)EBoxPY_Stream_close, METH_NOARGS, PyDoc_STR("EBoxPY.Stream.close()\nReleases the read-ahead buffer, further Reads raise ValueError.")},
+	{"__enter__", (PyCFunction)EBoxPY_Stream_enter, METH_NOARGS, NULL},
+	{"__exit__", (PyCFunction)EBoxPY_Stream_exit, METH_VARARGS, NULL},
+	{NULL}
+};
+
+static PyTypeObject EBoxPY_Stream_Type = {
+	PyObject_HEAD_INIT(NULL)
+	.tp_name = "EBoxPY.Stream",
+	.tp_basicsize = sizeof(EBoxPY_Stream),
+	.tp_doc = EBoxPY_Stream__doc__,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_members = EBoxPY_Stream_Members,
+	.tp_dealloc = EBoxPY_Stream_dealloc,
+	.tp_repr = EBoxPY_Stream_repr,
+	.tp_str = EBoxPY_Stream_repr,
+	.tp_methods = EBoxPY_Stream_Methods,
+	.tp_iter = EBoxPY_Stream_iter,
+	.tp_iternext = EBoxPY_Stream_next,
+};
+
+static int _EBoxPY_Initialize_Stream(PyObject* self) {
+	if (PyType_Ready(&EBoxPY_Stream_Type) < 0)
+		return 0;
+	PyModule_AddObject(self, "Stream", (PyObject*)&EBoxPY_Stream_Type);
+	// Registration only affects isinstance checks, a failure here leaves the Stream usable.
+	PyObject* io = PyImport_ImportModule("io");
+	if (io) {
+		PyObject* base = PyObject_GetAttrString(io, "RawIOBase");
+		PyObject* registered = (base ? PyObject_CallMethod(base, "register", "O", (PyObject*)&EBoxPY_Stream_Type) : NULL);
+		Py_XDECREF(registered);
+		Py_XDECREF(base);
+		Py_DECREF(io);
+	}
+	PyErr_Clear();
+	return 1;
+}
+
+static void EBoxPY_Stream_dealloc(PyObject* self) {
+	PEBoxPY_Stream stream = (PEBoxPY_Stream)self;
+	free(stream->Buffer_);
+	Py_XDECREF(stream->Process_);
+	Py_TYPE(self)->tp_free(self);
+}
+
+static PyObject* EBoxPY_Stream_repr(PyObject* self) {
+	PEBoxPY_Stream stream = (PEBoxPY_Stream)self;
+	char buffer[128] = {0};
+	sprintf(buffer, "<EBoxPY.Stream: (Address: 0x%llX) (Size: %llu) (Position: %llu)>", stream->Address_, stream->Size_, stream->Position_);
+	return PyUnicode_FromString(buffer);
+}
+
+// Reads [_Offset, _Offset + _Size) of the Stream, a failed Read is retried page by page and the unreadable pages are zeroed.
+static void _EBoxPY_Stream_Fetch(PEBoxPY_Stream _Stream, unsigned long long _Offset, unsigned char* _Buffer, unsigned long long _Size) {
+	unsigned long long address = _Stream->Address_ + _Offset;
+	++_Stream->Reads_;
+	if (_EBoxPY_Process_Read(_Stream->Process_, address, _Buffer, _Size))
+		return;
+	for (unsigned long long done = 0; done < _Size;) {
+		unsigned long long chunk = EBOXPY_PAGE_SIZE - ((address + done) & (EBOXPY_PAGE_SIZE - 1));
+		if (chunk > _Size - done)
+			chunk = _Size - done;
+		++_Stream->Reads_;
+		if (!_EBoxPY_Process_Read(_Stream->Process_, address + done, _Buffer + done, chunk)) {
+			memset(_Buffer + done, 0, (size_t)chunk);
+			++_Stream->Zeroed_;
+		}
+		done += chunk;
 	}
 }
-*/
 
-static PyObject* EBoxPY_Process_ReadTo(PEBoxPY_Process self, PyObject* args) {
-	if (!self->IsOpen_) {
+// Runs without the GIL. A View destination is only written through the faulting copy, -1 when it faults.
+static int _EBoxPY_Stream_Read(PEBoxPY_Stream _Stream, unsigned char* _Buffer, unsigned long long _Size, int _View, unsigned long long* _Read) {
+	*_Read = 0;
+	if (_Stream->Position_ >= _Stream->Size_)
+		return 1;
+	if (_Size > _Stream->Size_ - _Stream->Position_)
+		_Size = _Stream->Size_ - _Stream->Position_;
+	while (*_Read < _Size) {
+		unsigned long long position = _Stream->Position_;
+		if (position >= _Stream->BufferStart_ && position - _Stream->BufferStart_ < _Stream->BufferSize_) {
+			unsigned long long chunk = _Stream->BufferSize_ - (position - _Stream->BufferStart_);
+			if (chunk > _Size - *_Read)
+				chunk = _Size - *_Read;
+			if (!_EBoxPY_Bytes_Transfer(_Buffer + *_Read, _Stream->Buffer_ + (position - _Stream->BufferStart_), chunk, _View))
+				return -1;
+			*_Read += chunk;
+			_Stream->Position_ += chunk;
+			continue;
+		}
+		_Stream->Window_ = (position == _Stream->Next_ ? (_Stream->Window_ * 2 < EBOXPY_STREAM_MAXIMUM ? _Stream->Window_ * 2 : EBOXPY_STREAM_MAXIMUM) : EBOXPY_STREAM_MINIMUM);
+		unsigned long long remaining = _Size - *_Read;
+		// Requests at least as large as the read-ahead go straight into the caller's buffer.
+		if (remaining >= _Stream->Window_ && !_View) {
+			_EBoxPY_Stream_Fetch(_Stream, position, _Buffer + *_Read, remaining);
+			*_Read += remaining;
+			_Stream->Position_ += remaining;
+			_Stream->Next_ = _Stream->Position_;
+			continue;
+		}
+		if (!_Stream->Buffer_) {
+			_Stream->Buffer_ = (unsigned char*)malloc(EBOXPY_STREAM_MAXIMUM);
+			if (!_Stream->Buffer_)
+				return 0;
+		}
+		unsigned long long window = (_Stream->Window_ < _Stream->Size_ - position ? _Stream->Window_ : _Stream->Size_ - position);
+		_EBoxPY_Stream_Fetch(_Stream, position, _Stream->Buffer_, window);
+		_Stream->BufferStart_ = position;
+		_Stream->BufferSize_ = window;
+		_Stream->Next_ = position + window;
+	}
+	return 1;
+}
+
+// Runs without the GIL. Reads small chunks through the read-ahead and steps Position_ back to just past the first b'\n'.
+static int _EBoxPY_Stream_Line(PEBoxPY_Stream _Stream, unsigned long long _Limit, unsigned char** _Line, unsigned long long* _Size) {
+	unsigned char* line = NULL;
+	unsigned long long size = 0;
+	unsigned long long capacity = 0;
+	while (size < _Limit) {
+		unsigned long long chunk = (_Limit - size < EBOXPY_STREAM_LINE ? _Limit - size : EBOXPY_STREAM_LINE);
+		if (size + chunk > capacity) {
+			unsigned long long grown = (capacity * 2 > size + chunk ? capacity * 2 : size + chunk);
+			unsigned char* data = (unsigned char*)realloc(line, (size_t)grown);
+			if (!data) {
+				free(line);
+				return 0;
+			}
+			line = data;
+			capacity = grown;
+		}
+		unsigned long long read = 0;
+		int status = _EBoxPY_Stream_Read(_Stream, line + size, chunk, 0, &read);
+		if (status <= 0) {
+			free(line);
+			return status;
+		}
+		if (!read)
+			break;
+		unsigned char* end = (unsigned char*)memchr(line + size, '\n', (size_t)read);
+		if (end) {
+			unsigned long long keep = (unsigned long long)(end - (line + size)) + 1;
+			_Stream->Position_ -= read - keep;
+			size += keep;
+			break;
+		}
+		size += read;
+	}
+	*_Line = line;
+	*_Size = size;
+	return 1;
+}
+
+// Marks the Stream busy and pins the Process so a Read can release the GIL, every Begin is paired with an End.
+static int _EBoxPY_Stream_Begin(PEBoxPY_Stream _Stream) {
+	if (_Stream->IsClosed_) {
+		PyErr_SetString(PyExc_ValueError, "EBoxPY.Stream.IsClosed_ was True.");
+		return 0;
+	}
+	if (_Stream->IsBusy_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Stream is already Reading.");
+		return 0;
+	}
+	if (!_EBoxPY_Process_Pin(_Stream->Process_)) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
-		return NULL;
+		return 0;
 	}
-	if (PyTuple_Size(args) != 4) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires 2 arguments.");
-		return NULL;
+	_Stream->IsBusy_ = (char)1;
+	return 1;
+}
+
+static void _EBoxPY_Stream_End(PEBoxPY_Stream _Stream) {
+	_Stream->IsBusy_ = (char)0;
+	_EBoxPY_Process_Unpin(_Stream->Process_);
+}
+
+static int _EBoxPY_Stream_Status(int _Status, const char* _Name) {
+	if (_Status < 0)
+		PyErr_Format(PyExc_RuntimeError, "EBoxPY.Stream.%s faulted on the View's memory.", _Name);
+	else if (!_Status)
+		PyErr_Format(PyExc_RuntimeError, "EBoxPY.Stream.%s failed to Allocate the read-ahead buffer.", _Name);
+	return _Status > 0;
+}
+
+static PyObject* EBoxPY_Stream_readinto(PEBoxPY_Stream self, PyObject* buffer) {
+	if (!_EBoxPY_Stream_Begin(self))
+		return NULL;
+	unsigned long long read = 0;
+	int status = 0;
+	if (PyObject_TypeCheck(buffer, &EBoxPY_Bytes_Type)) {
+		PEBoxPY_Bytes bytes = (PEBoxPY_Bytes)buffer;
+		if (bytes->IsView_ && !bytes->IsWritable_) {
+			_EBoxPY_Stream_End(self);
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Bytes.IsWritable_ was False.");
+			return NULL;
+		}
+		unsigned char* allocation = bytes->Allocation_;
+		unsigned long long size = bytes->Size_;
+		int view = bytes->IsView_;
+		Py_BEGIN_ALLOW_THREADS
+		status = _EBoxPY_Stream_Read(self, allocation, size, view, &read);
+		Py_END_ALLOW_THREADS
 	}
-	if (!PyLong_Check(PyTuple_GetItem(args, 0))) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires _Address to be int.");
-		return NULL;
+	else {
+		Py_buffer view;
+		if (PyObject_GetBuffer(buffer, &view, PyBUF_WRITABLE) < 0) {
+			_EBoxPY_Stream_End(self);
+			return NULL;
+		}
+		Py_BEGIN_ALLOW_THREADS
+		status = _EBoxPY_Stream_Read(self, (unsigned char*)view.buf, (unsigned long long)view.len, 0, &read);
+		Py_END_ALLOW_THREADS
+		PyBuffer_Release(&view);
 	}
-	if (!PyObject_IsInstance(PyTuple_GetItem(args, 1), (PyObject*)&EBoxPY_Bytes_Type)) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires _Bytes to be a Bytes object.");
+	_EBoxPY_Stream_End(self);
+	if (!_EBoxPY_Stream_Status(status, "readinto"))
 		return NULL;
-	}
-	if (!PyLong_Check(PyTuple_GetItem(args, 2))) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires _Start to be int.");
+	return PyLong_FromUnsignedLongLong(read);
+}
+
+static PyObject* EBoxPY_Stream_read(PEBoxPY_Stream self, PyObject* args) {
+	long long size = -1;
+	if (!PyArg_ParseTuple(args, "|L", &size))
 		return NULL;
-	}
-	if (!PyLong_Check(PyTuple_GetItem(args, 3))) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires _Size to be int.");
+	if (!_EBoxPY_Stream_Begin(self))
 		return NULL;
-	}
-	unsigned long long address = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 0));
-	if (PyErr_Occurred()) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires a valid int _Address.");
+	unsigned long long remaining = (self->Position_ < self->Size_ ? self->Size_ - self->Position_ : 0);
+	if (size < 0 || (unsigned long long)size > remaining)
+		size = (long long)remaining;
+	PyObject* output = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)size);
+	if (!output) {
+		_EBoxPY_Stream_End(self);
 		return NULL;
 	}
-	PEBoxPY_Bytes bytes = (PEBoxPY_Bytes)PyTuple_GetItem(args, 1);
-	unsigned long long start = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 2));
-	if (PyErr_Occurred()) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires a valid int _Start.");
+	unsigned char* data = (unsigned char*)PyBytes_AS_STRING(output);
+	unsigned long long read = 0;
+	int status = 0;
+	Py_BEGIN_ALLOW_THREADS
+	status = _EBoxPY_Stream_Read(self, data, (unsigned long long)size, 0, &read);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Stream_End(self);
+	if (!_EBoxPY_Stream_Status(status, "read")) {
+		Py_DECREF(output);
 		return NULL;
 	}
-	unsigned long long size = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 3));
-	if (PyErr_Occurred()) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.ReadTo requires a valid int _Size.");
+	return output;
+}
+
+static PyObject* EBoxPY_Stream_readall(PEBoxPY_Stream self) {
+	PyObject* args = PyTuple_New(0);
+	if (!args)
 		return NULL;
-	}
-	if (start + size > bytes->Size_) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.ReadTo address out of bounds.");
+	PyObject* output = EBoxPY_Stream_read(self, args);
+	Py_DECREF(args);
+	return output;
+}
+
+static PyObject* EBoxPY_Stream_readline(PEBoxPY_Stream self, PyObject* args) {
+	long long size = -1;
+	if (!PyArg_ParseTuple(args, "|L", &size))
+		return NULL;
+	if (!_EBoxPY_Stream_Begin(self))
+		return NULL;
+	unsigned char* line = NULL;
+	unsigned long long read = 0;
+	int status = 0;
+	Py_BEGIN_ALLOW_THREADS
+	status = _EBoxPY_Stream_Line(self, (size < 0 ? ~0ull : (unsigned long long)size), &line, &read);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Stream_End(self);
+	if (!_EBoxPY_Stream_Status(status, "readline"))
+		return NULL;
+	PyObject* output = PyBytes_FromStringAndSize((const char*)line, (Py_ssize_t)read);
+	free(line);
+	return output;
+}
+
+static PyObject* EBoxPY_Stream_readlines(PEBoxPY_Stream self, PyObject* args) {
+	long long hint = -1;
+	if (!PyArg_ParseTuple(args, "|L", &hint))
 		return NULL;
-	}
-	if (ReadProcessMemory(self->Process_, (void*)address, bytes->Allocation_ + start, size, NULL) == FALSE) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.ReadTo failed to Read memory.");
+	PyObject* empty = PyTuple_New(0);
+	PyObject* output = PyList_New(0);
+	if (!empty || !output) {
+		Py_XDECREF(empty);
+		Py_XDECREF(output);
 		return NULL;
 	}
-	Py_INCREF(Py_None);
-	return Py_None;
+	unsigned long long total = 0;
+	while (hint <= 0 || total < (unsigned long long)hint) {
+		PyObject* line = EBoxPY_Stream_readline(self, empty);
+		if (!line) {
+			Py_DECREF(empty);
+			Py_DECREF(output);
+			return NULL;
+		}
+		Py_ssize_t size = PyBytes_GET_SIZE(line);
+		if (!size) {
+			Py_DECREF(line);
+			break;
+		}
+		int appended = (PyList_Append(output, line) == 0);
+		Py_DECREF(line);
+		if (!appended) {
+			Py_DECREF(empty);
+			Py_DECREF(output);
+			return NULL;
+		}
+		total += (unsigned long long)size;
+	}
+	Py_DECREF(empty);
+	return output;
 }
 
-static PyObject* EBoxPY_Process_WriteFrom(PEBoxPY_Process self, PyObject* args) {
-	if (!self->IsOpen_) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+static PyObject* EBoxPY_Stream_iter(PyObject* self) {
+	if (((PEBoxPY_Stream)self)->IsClosed_) {
+		PyErr_SetString(PyExc_ValueError, "EBoxPY.Stream.IsClosed_ was True.");
 		return NULL;
 	}
-	if (PyTuple_Size(args) != 4) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.WriteFrom requires 2 arguments.");
+	Py_INCREF(self);
+	return self;
+}
+
+// An empty line is the end, returning NULL without an exception stops the iteration.
+static PyObject* EBoxPY_Stream_next(PyObject* self) {
+	PyObject* empty = PyTuple_New(0);
+	if (!empty)
+		return NULL;
+	PyObject* line = EBoxPY_Stream_readline((PEBoxPY_Stream)self, empty);
+	Py_DECREF(empty);
+	if (line && !PyBytes_GET_SIZE(line)) {
+		Py_DECREF(line);
 		return NULL;
 	}
-	if (!PyLong_Check(PyTuple_GetItem(args, 0))) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.WriteFrom requires _Address to be int.");
+	return line;
+}
+
+static PyObject* EBoxPY_Stream_seek(PEBoxPY_Stream self, PyObject* args) {
+	long long offset = 0;
+	int whence = 0;
+	if (!PyArg_ParseTuple(args, "L|i", &offset, &whence))
+		return NULL;
+	if (self->IsClosed_) {
+		PyErr_SetString(PyExc_ValueError, "EBoxPY.Stream.IsClosed_ was True.");
 		return NULL;
 	}
-	if (!PyObject_IsInstance(PyTuple_GetItem(args, 1), (PyObject*)&EBoxPY_Bytes_Type)) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.WriteFrom requires _Bytes to be a Bytes object.");
+	if (self->IsBusy_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Stream is already Reading.");
 		return NULL;
 	}
-	unsigned long long address = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 0));
-	if (PyErr_Occurred()) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.WriteFrom requires a valid int _Address.");
+	long long base = 0;
+	if (whence == 1)
+		base = (long long)self->Position_;
+	else if (whence == 2)
+		base = (long long)self->Size_;
+	else if (whence != 0) {
+		PyErr_SetString(PyExc_ValueError, "EBoxPY.Stream.seek requires _Whence to be 0, 1 or 2.");
 		return NULL;
 	}
-	PEBoxPY_Bytes bytes = (PEBoxPY_Bytes)PyTuple_GetItem(args, 1);
-	unsigned long long start = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 2));
-	if (PyErr_Occurred()) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.WriteFrom requires a valid int _Start.");
+	if (base + offset < 0) {
+		PyErr_SetString(PyExc_ValueError, "EBoxPY.Stream.seek requires the new position to be >= 0.");
 		return NULL;
 	}
-	unsigned long long size = PyLong_AsUnsignedLongLong(PyTuple_GetItem(args, 3));
-	if (PyErr_Occurred()) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.WriteFrom requires a valid int _Size.");
+	self->Position_ = (unsigned long long)(base + offset);
+	return PyLong_FromUnsignedLongLong(self->Position_);
+}
+
+static PyObject* EBoxPY_Stream_tell(PEBoxPY_Stream self) {
+	if (self->IsClosed_) {
+		PyErr_SetString(PyExc_ValueError, "EBoxPY.Stream.IsClosed_ was True.");
 		return NULL;
 	}
-	if (start + size > bytes->Size_) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.WriteFrom address out of bounds.");
+	return PyLong_FromUnsignedLongLong(self->Position_);
+}
+
+static PyObject* EBoxPY_Stream_readable(PEBoxPY_Stream self) {
+	Py_INCREF(Py_True);
+	return Py_True;
+}
+
+static PyObject* EBoxPY_Stream_seekable(PEBoxPY_Stream self) {
+	Py_INCREF(Py_True);
+	return Py_True;
+}
+
+static PyObject* EBoxPY_Stream_writable(PEBoxPY_Stream self) {
+	Py_INCREF(Py_False);
+	return Py_False;
+}
+
+static PyObject* EBoxPY_Stream_flush(PEBoxPY_Stream self) {
+	Py_INCREF(Py_None);
+	return Py_None;
+}
+
+static PyObject* EBoxPY_Stream_isatty(PEBoxPY_Stream self) {
+	if (self->IsClosed_) {
+		PyErr_SetString(PyExc_ValueError, "EBoxPY.Stream.IsClosed_ was True.");
 		return NULL;
 	}
-	if (WriteProcessMemory(self->Process_, (void*)address, bytes->Allocation_ + start, size, NULL) == FALSE) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.WriteFrom failed to Write memory.");
+	Py_INCREF(Py_False);
+	return Py_False;
+}
+
+static PyObject* EBoxPY_Stream_fileno(PEBoxPY_Stream self) {
+	PyObject* io = PyImport_ImportModule("io");
+	PyObject* unsupported = (io ? PyObject_GetAttrString(io, "UnsupportedOperation") : NULL);
+	Py_XDECREF(io);
+	if (!unsupported)
+		return NULL;
+	PyErr_SetString(unsupported, "EBoxPY.Stream has no file descriptor.");
+	Py_DECREF(unsupported);
+	return NULL;
+}
+
+static PyObject* EBoxPY_Stream_close(PEBoxPY_Stream self) {
+	if (self->IsBusy_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Stream is already Reading.");
 		return NULL;
 	}
+	free(self->Buffer_);
+	self->Buffer_ = NULL;
+	self->BufferSize_ = 0;
+	self->IsClosed_ = (char)1;
 	Py_INCREF(Py_None);
 	return Py_None;
 }
 
-static PyObject* EBoxPY_Process_GetThreads(PEBoxPY_Process self) {
+static PyObject* EBoxPY_Stream_enter(PEBoxPY_Stream self) {
+	Py_INCREF(self);
+	return (PyObject*)self;
+}
+
+static PyObject* EBoxPY_Stream_exit(PEBoxPY_Stream self, PyObject* args) {
+	return EBoxPY_Stream_close(self);
+}
+
+static PyObject* EBoxPY_Process_OpenStream(PEBoxPY_Process self, PyObject* args) {
 	if (!self->IsOpen_) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
 		return NULL;
 	}
-	PyObject* output = PyList_New(0);
-	if (!output) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.GetThreads Failed to Create output list.");
+	unsigned long long address = 0;
+	unsigned long long size = 0;
+	if (!PyArg_ParseTuple(args, "KK", &address, &size))
 		return NULL;
-	}
-	HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
-	if (!snapshot || snapshot == INVALID_HANDLE_VALUE){
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.GetThreads Failed to Create Snapshot.");
+	if (address + size < address) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.OpenStream Requires _Address + _Size to fit in 64 bits.");
 		return NULL;
 	}
-	THREADENTRY32 entry = {0};
-	entry.dwSize = sizeof(THREADENTRY32);
-	for (BOOL b = Thread32First(snapshot, &entry); b == TRUE; b = Thread32Next(snapshot, &entry)) {
-		if (entry.th32OwnerProcessID == self->ID_) {
-			PyObject* thread = _EBoxPY_Create_Thread_ID(entry.th32ThreadID);
-			if (!thread)
-				continue;
-			PyList_Append(output, thread);
-			Py_DECREF(thread);
-		}
-	}
-	CloseHandle(snapshot);
+	PyObject* output = EBoxPY_Stream_Type.tp_alloc(&EBoxPY_Stream_Type, 1);
+	if (!output)
+		return NULL;
+	EBOXPY_OBJECT_ZERO(EBoxPY_Stream, output);
+	PEBoxPY_Stream stream = (PEBoxPY_Stream)output;
+	Py_INCREF(self);
+	stream->Process_ = (PyObject*)self;
+	stream->Address_ = address;
+	stream->Size_ = size;
+	stream->Window_ = EBOXPY_STREAM_MINIMUM;
 	return output;
 }
 
-static PyObject* EBoxPY_Process_Allocate(PEBoxPY_Process self, PyObject* args) {
-	if (!self->IsOpen_) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+/*
+ *
+ * EBoxPY.PatchSet
+ *
+ */
+
+PyDoc_STRVAR(EBoxPY_PatchSet__doc__, "EBoxPY PatchSet object, a group of byte patches in a Process that are Applied and Reverted together.\nApply verifies every expected original in one batched Read while the Process is suspended, changes each touched page's protection once, Writes every patch and restores the protections before resuming.\nThe current Process is never suspended, a PatchSet dropped while Applied leaves its patches in place.");
+
+typedef struct _EBoxPY_Patch_T {
+	unsigned long long Address_;
+	unsigned long long Size_;
+	unsigned char* Data_;
+	unsigned char* Original_;
+	char HasOriginal_;
+} _EBoxPY_Patch, *_PEBoxPY_Patch;
+
+typedef struct _EBoxPY_Patch_Page_T {
+	unsigned long long Page_;
+	unsigned long Protect_;
+} _EBoxPY_Patch_Page, *_PEBoxPY_Patch_Page;
+
+typedef struct EBoxPY_PatchSet_T {
+	//
+	PyObject_HEAD
+	//
+	PyObject* Process_;
+	unsigned long long Count_;
+	unsigned long long Pages_;
+	char IsApplied_;
+	char IsBusy_;
+	//
+	_PEBoxPY_Patch Patches_;
+	unsigned long long Capacity_;
+	//
+} EBoxPY_PatchSet, *PEBoxPY_PatchSet;
+
+static void EBoxPY_PatchSet_dealloc(PyObject* self);
+static PyObject* EBoxPY_PatchSet_repr(PyObject* self);
+
+static PyObject* EBoxPY_PatchSet_Add(PEBoxPY_PatchSet self, PyObject* args);
+static PyObject* EBoxPY_PatchSet_Apply(PEBoxPY_PatchSet self);
+static PyObject* EBoxPY_PatchSet_Revert(PEBoxPY_PatchSet self);
+
+static PyMemberDef EBoxPY_PatchSet_Members[] = {
+	{"Process_", T_OBJECT, offsetof(EBoxPY_PatchSet, Process_), READONLY, PyDoc_STR("The Process being patched.")},
+	{"Count_", T_ULONGLONG, offsetof(EBoxPY_PatchSet, Count_), READONLY, PyDoc_STR("The number of patches.")},
+	{"Pages_", T_ULONGLONG, offsetof(EBoxPY_PatchSet, Pages_), READONLY, PyDoc_STR("The number of pages whose protection was changed by the last Apply or Revert.")},
+	{"IsApplied_", T_BOOL, offsetof(EBoxPY_PatchSet, IsApplied_), READONLY, PyDoc_STR("True while the patches are Applied.")},
+	{"IsBusy_", T_BOOL, offsetof(EBoxPY_PatchSet, IsBusy_), READONLY, PyDoc_STR("True while an Apply or Revert is Running.")},
+	{NULL}
+};
+
+static PyMethodDef EBoxPY_PatchSet_Methods[] = {
+	{"Add", (PyCFunction)EBoxPY_PatchSet_Add, METH_VARARGS, PyDoc_STR("EBoxPY.PatchSet.Add(_Address, _Bytes, _Original=None)\nAdds a patch of _Bytes at _Address, bytes or EBoxPY.Bytes, Apply fails unless the memory still holds _Original when it is given.")},
+	{"Apply", (PyCFunction)EBoxPY_PatchSet_Apply, METH_NOARGS, PyDoc_STR("EBoxPY.PatchSet.Apply()\nWrites every patch in one suspended pass after verifying the originals, saving the bytes it replaces.\nNothing is left written if any patch fails.")},
+	{"Revert", (PyCFunction)EBoxPY_PatchSet_Revert, METH_NOARGS, PyDoc_STR("EBoxPY.PatchSet.Revert()\nRestores the bytes saved by Apply in one suspended pass, after verifying the patches are still in place.")},
+	{NULL}
+};
+
+static PyTypeObject EBoxPY_PatchSet_Type = {
+	PyObject_HEAD_INIT(NULL)
+	.tp_name = "EBoxPY.PatchSet",
+	.tp_basicsize = sizeof(EBoxPY_PatchSet),
+	.tp_doc = EBoxPY_PatchSet__doc__,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_members = EBoxPY_PatchSet_Members,
+	.tp_dealloc = EBoxPY_PatchSet_dealloc,
+	.tp_repr = EBoxPY_PatchSet_repr,
+	.tp_str = EBoxPY_PatchSet_repr,
+	.tp_methods = EBoxPY_PatchSet_Methods,
+};
+
+static int _EBoxPY_Initialize_PatchSet(PyObject* self) {
+	if (PyType_Ready(&EBoxPY_PatchSet_Type) < 0)
+		return 0;
+	PyModule_AddObject(self, "PatchSet", (PyObject*)&EBoxPY_PatchSet_Type);
+	return 1;
+}
+
+static void EBoxPY_PatchSet_dealloc(PyObject* self) {
+	PEBoxPY_PatchSet patches = (PEBoxPY_PatchSet)self;
+	for (unsigned long long i = 0; i < patches->Count_; ++i) {
+		free(patches->Patches_[i].Data_);
+		free(patches->Patches_[i].Original_);
+	}
+	free(patches->Patches_);
+	Py_XDECREF(patches->Process_);
+	Py_TYPE(self)->tp_free(self);
+}
+
+static PyObject* EBoxPY_PatchSet_repr(PyObject* self) {
+	PEBoxPY_PatchSet patches = (PEBoxPY_PatchSet)self;
+	char buffer[96] = {0};
+	sprintf(buffer, "<EBoxPY.PatchSet: (Count: %llu) (IsApplied: %i)>", patches->Count_, (int)patches->IsApplied_);
+	return PyUnicode_FromString(buffer);
+}
+
+static PyObject* EBoxPY_PatchSet_Add(PEBoxPY_PatchSet self, PyObject* args) {
+	unsigned long long address = 0;
+	PyObject* _data = NULL;
+	PyObject* _original = Py_None;
+	if (!PyArg_ParseTuple(args, "KO|O", &address, &_data, &_original))
 		return NULL;
-	}
-	Py_ssize_t length = PyTuple_Size(args);
-	if (length < 1 || length > 3){
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Allocate Takes 1-3 Arguments.");
+	if (self->IsBusy_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.PatchSet is already Running.");
 		return NULL;
 	}
-	PyObject* size = (PyTuple_GetItem(args, 0) == Py_None ? NULL : PyTuple_GetItem(args, 0));
-	PyObject* address = (length < 2 ? NULL : (PyTuple_GetItem(args, 1) == Py_None ? NULL : PyTuple_GetItem(args, 1)));
-	PyObject* range = (length < 3 ? NULL : (PyTuple_GetItem(args, 2) == Py_None ? NULL : PyTuple_GetItem(args, 2)));
-	if (!size || !PyLong_Check(size)) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Allocate Takes int as _Size.");
+	if (self->IsApplied_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.PatchSet.IsApplied_ was True.");
 		return NULL;
 	}
-	unsigned long long _size = PyLong_AsUnsignedLongLong(size);
-	long long _address = (!address ? 0 : PyLong_AsLongLong(address));
-	long long _range = (!range ? 0 : PyLong_AsLongLong(range));
-	if (!address && range) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Allocate Invalid Arguments.");
+	_EBoxPY_Patch patch;
+	memset(&patch, 0, sizeof(_EBoxPY_Patch));
+	patch.Address_ = address;
+	patch.Data_ = _EBoxPY_Bytes_Duplicate(_data, &patch.Size_);
+	if (!patch.Data_)
+		return NULL;
+	if (!patch.Size_ || address + patch.Size_ < address) {
+		free(patch.Data_);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.PatchSet.Add Requires _Bytes to be non-empty and to fit in 64 bits at _Address.");
 		return NULL;
 	}
-	else if (!address && !range) {
-		unsigned long long __address = (unsigned long long)VirtualAllocEx(self->Process_, NULL, _size, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
-		if (!__address) {
-			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Allocate Failed to Allocate Memory.");
+	if (_original != Py_None) {
+		unsigned long long size = 0;
+		patch.Original_ = _EBoxPY_Bytes_Duplicate(_original, &size);
+		if (!patch.Original_) {
+			free(patch.Data_);
 			return NULL;
 		}
-		return PyLong_FromUnsignedLongLong(__address);
-	}
-	else if (address && !range) {
-		unsigned long long __address = (unsigned long long)VirtualAllocEx(self->Process_, (void*)_address, _size, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
-		if (!__address) {
-			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Allocate Failed to Allocate Memory.");
+		if (size != patch.Size_) {
+			free(patch.Data_);
+			free(patch.Original_);
+			PyErr_SetString(PyExc_RuntimeError, "EBoxPY.PatchSet.Add Requires _Original to be the same Size as _Bytes.");
 			return NULL;
 		}
-		return PyLong_FromUnsignedLongLong(__address);
+		patch.HasOriginal_ = (char)1;
 	}
 	else {
-		SYSTEM_INFO information;
-		GetSystemInfo(&information);
-		long long start = _address - _range;
-		start &= ~((unsigned long long)(information.dwAllocationGranularity - 1));
-		if (start < (_address - _range))
-			start += information.dwAllocationGranularity;
-		long long end = _address + _range - _size;
-		end &= ~((unsigned long long)(information.dwAllocationGranularity - 1));
-		if (end > (_address + _range - (long long)_size))
-			end -= information.dwAllocationGranularity;
-		for (long long i = start; i < end; i += 0x1000) {
-			unsigned long long __address = (unsigned long long)VirtualAllocEx(self->Process_, (void*)i, _size, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
-			if (__address)
-				return PyLong_FromUnsignedLongLong(__address);
+		patch.Original_ = (unsigned char*)malloc((size_t)patch.Size_);
+		if (!patch.Original_) {
+			free(patch.Data_);
+			return PyErr_NoMemory();
 		}
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Allocate Failed to Allocate Memory.");
-		return NULL;
 	}
+	// Duplicating a bytes-like object can run Python code, an Apply or Revert may have started in between.
+	if (self->IsBusy_ || self->IsApplied_) {
+		free(patch.Data_);
+		free(patch.Original_);
+		PyErr_SetString(PyExc_RuntimeError, (self->IsBusy_ ? "EBoxPY.PatchSet is already Running." : "EBoxPY.PatchSet.IsApplied_ was True."));
+		return NULL;
+	}
+	// Patches are kept sorted by Address_ so pages and Reads can be batched, overlaps are rejected here.
+	unsigned long long low = 0;
+	unsigned long long high = self->Count_;
+	while (low < high) {
+		unsigned long long middle = low + (high - low) / 2;
+		if (self->Patches_[middle].Address_ < address)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	if ((low < self->Count_ && self->Patches_[low].Address_ < address + patch.Size_) || (low && self->Patches_[low - 1].Address_ + self->Patches_[low - 1].Size_ > address)) {
+		free(patch.Data_);
+		free(patch.Original_);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.PatchSet.Add Requires patches not to overlap.");
+		return NULL;
+	}
+	if (self->Count_ == self->Capacity_) {
+		unsigned long long capacity = (self->Capacity_ ? self->Capacity_ * 2 : 16);
+		_PEBoxPY_Patch patches = (_PEBoxPY_Patch)realloc(self->Patches_, (size_t)capacity * sizeof(_EBoxPY_Patch));
+		if (!patches) {
+			free(patch.Data_);
+			free(patch.Original_);
+			return PyErr_NoMemory();
+		}
+		self->Patches_ = patches;
+		self->Capacity_ = capacity;
+	}
+	memmove(&self->Patches_[low + 1], &self->Patches_[low], (size_t)(self->Count_ - low) * sizeof(_EBoxPY_Patch));
+	self->Patches_[low] = patch;
+	++self->Count_;
+	Py_INCREF(Py_None);
+	return Py_None;
 }
 
-static PyObject* EBoxPY_Process_Free(PEBoxPY_Process self, PyObject* allocation) {
-	if (!self->IsOpen_) {
+// Restores the protections of _Pages[0, _Count).
+static void _EBoxPY_PatchSet_Restore(HANDLE _Process, _PEBoxPY_Patch_Page _Pages, unsigned long long _Count) {
+	DWORD old = 0;
+	for (unsigned long long i = 0; i < _Count; ++i)
+		VirtualProtectEx(_Process, (LPVOID)_Pages[i].Page_, EBOXPY_PAGE_SIZE, _Pages[i].Protect_, &old);
+}
+
+// Runs without the GIL. _Revert swaps the roles of Data_ and Original_, the current bytes must match what is being replaced.
+static int _EBoxPY_PatchSet_Write(PEBoxPY_PatchSet _PatchSet, int _Revert, const char** _Error) {
+	PEBoxPY_Process process = (PEBoxPY_Process)_PatchSet->Process_;
+	_PEBoxPY_Patch patches = _PatchSet->Patches_;
+	unsigned long long count = _PatchSet->Count_;
+	_PatchSet->Pages_ = 0;
+	if (!count)
+		return 1;
+	// Patches less than a page apart share one Read.
+	unsigned long long total = 0;
+	unsigned long long pages = 0;
+	for (unsigned long long i = 0; i < count; ++i) {
+		if (!i || patches[i].Address_ - (patches[i - 1].Address_ + patches[i - 1].Size_) >= EBOXPY_PAGE_SIZE)
+			total += patches[i].Size_;
+		else
+			total += patches[i].Address_ + patches[i].Size_ - (patches[i - 1].Address_ + patches[i - 1].Size_);
+		pages += (patches[i].Address_ + patches[i].Size_ - 1) / EBOXPY_PAGE_SIZE - patches[i].Address_ / EBOXPY_PAGE_SIZE + 1;
+	}
+	unsigned char* current = (unsigned char*)malloc((size_t)total);
+	unsigned long long* offsets = (unsigned long long*)malloc((size_t)count * sizeof(unsigned long long));
+	_PEBoxPY_Patch_Page flipped = (_PEBoxPY_Patch_Page)malloc((size_t)pages * sizeof(_EBoxPY_Patch_Page));
+	if (!current || !offsets || !flipped) {
+		free(current);
+		free(offsets);
+		free(flipped);
+		*_Error = "failed to Allocate.";
+		return 0;
+	}
+	int status = 0;
+	int suspended = (!process->IsSelf_ && _EBoxPY_Process_Suspend(process->Process_, 0));
+	if (!process->IsSelf_ && !suspended) {
+		*_Error = "failed to Suspend the Process.";
+		goto done;
+	}
+	unsigned long long offset = 0;
+	for (unsigned long long i = 0, first = 0; i < count; ++i) {
+		unsigned long long end = patches[i].Address_ + patches[i].Size_;
+		if (i && patches[i].Address_ - (patches[i - 1].Address_ + patches[i - 1].Size_) < EBOXPY_PAGE_SIZE) {
+			offsets[i] = offsets[i - 1] + (patches[i].Address_ - patches[i - 1].Address_);
+		}
+		else {
+			first = i;
+			offsets[i] = offset;
+		}
+		if (i + 1 < count && patches[i + 1].Address_ - end < EBOXPY_PAGE_SIZE)
+			continue;
+		unsigned long long size = end - patches[first].Address_;
+		if (!_EBoxPY_Process_Read((PyObject*)process, patches[first].Address_, current + offsets[first], size)) {
+			*_Error = "failed to Read the patched ranges.";
+			goto done;
+		}
+		offset += size;
+	}
+	for (unsigned long long i = 0; i < count; ++i) {
+		const unsigned char* expected = (_Revert ? patches[i].Data_ : patches[i].Original_);
+		if ((_Revert || patches[i].HasOriginal_) && memcmp(current + offsets[i], expected, (size_t)patches[i].Size_)) {
+			*_Error = (_Revert ? "found a patch that was overwritten." : "found a patch whose original bytes differ.");
+			goto done;
+		}
+	}
+	if (!_Revert) {
+		for (unsigned long long i = 0; i < count; ++i)
+			memcpy(patches[i].Original_, current + offsets[i], (size_t)patches[i].Size_);
+	}
+	// Each page is made writable once however many patches it holds.
+	unsigned long long changed = 0;
+	for (unsigned long long i = 0; i < count; ++i) {
+		unsigned long long page = patches[i].Address_ & ~(unsigned long long)(EBOXPY_PAGE_SIZE - 1);
+		for (; page < patches[i].Address_ + patches[i].Size_; page += EBOXPY_PAGE_SIZE) {
+			if (changed && flipped[changed - 1].Page_ >= page)
+				continue;
+			DWORD old = 0;
+			if (!VirtualProtectEx(process->Process_, (LPVOID)page, EBOXPY_PAGE_SIZE, PAGE_EXECUTE_READWRITE, &old)) {
+				_EBoxPY_PatchSet_Restore(process->Process_, flipped, changed);
+				*_Error = "failed to change a page protection.";
+				goto done;
+			}
+			flipped[changed].Page_ = page;
+			flipped[changed].Protect_ = (unsigned long)old;
+			++changed;
+		}
+	}
+	unsigned long long written = 0;
+	for (; written < count; ++written) {
+		if (!_EBoxPY_Process_Write((PyObject*)process, patches[written].Address_, (_Revert ? patches[written].Original_ : patches[written].Data_), patches[written].Size_))
+			break;
+	}
+	// A failed Write puts back what was already written so the set is never half Applied.
+	if (written < count) {
+		for (unsigned long long i = 0; i < written; ++i)
+			_EBoxPY_Process_Write((PyObject*)process, patches[i].Address_, current + offsets[i], patches[i].Size_);
+		*_Error = "failed to Write a patch.";
+	}
+	_EBoxPY_PatchSet_Restore(process->Process_, flipped, changed);
+	for (unsigned long long i = 0; i < count; ++i)
+		FlushInstructionCache(process->Process_, (LPCVOID)patches[i].Address_, (SIZE_T)patches[i].Size_);
+	_PatchSet->Pages_ = changed;
+	status = (written == count);
+done:
+	if (suspended)
+		_EBoxPY_Process_Suspend(process->Process_, 1);
+	free(current);
+	free(offsets);
+	free(flipped);
+	return status;
+}
+
+static PyObject* _EBoxPY_PatchSet_Run(PEBoxPY_PatchSet _PatchSet, int _Revert) {
+	PEBoxPY_Process process = (PEBoxPY_Process)_PatchSet->Process_;
+	if (!process->IsOpen_) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
 		return NULL;
 	}
-	if (!PyLong_Check(allocation)) {
-		PyErr_SetString(PyExc_TypeError, "EBoxPY.Process.Free requires int as _Allocation.");
+	if (_PatchSet->IsBusy_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.PatchSet is already Running.");
 		return NULL;
 	}
-	unsigned long long address = PyLong_AsUnsignedLongLong(allocation);
-	if (!VirtualFreeEx(self->Process_, (void*)address, 0, MEM_RELEASE)) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.Free Failed to Free Memory.");
+	if (_PatchSet->IsApplied_ != (char)_Revert) {
+		PyErr_SetString(PyExc_RuntimeError, (_Revert ? "EBoxPY.PatchSet.IsApplied_ was False." : "EBoxPY.PatchSet.IsApplied_ was True."));
+		return NULL;
+	}
+	const char* error = NULL;
+	int status = 0;
+	if (!_EBoxPY_Process_Pin((PyObject*)process)) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+		return NULL;
+	}
+	// Patches_ and every Original_ are walked without the GIL, Add, Apply and Revert are refused until it is back.
+	_PatchSet->IsBusy_ = (char)1;
+	Py_BEGIN_ALLOW_THREADS
+	status = _EBoxPY_PatchSet_Write(_PatchSet, _Revert, &error);
+	Py_END_ALLOW_THREADS
+	_EBoxPY_Process_Unpin((PyObject*)process);
+	_PatchSet->IsBusy_ = (char)0;
+	if (!status) {
+		PyErr_Format(PyExc_RuntimeError, "EBoxPY.PatchSet.%s %s", (_Revert ? "Revert" : "Apply"), error);
 		return NULL;
 	}
+	_PatchSet->IsApplied_ = (char)!_Revert;
 	Py_INCREF(Py_None);
 	return Py_None;
 }
 
-static PyObject* EBoxPY_Process_IsI386(PEBoxPY_Process self) {
+static PyObject* EBoxPY_PatchSet_Apply(PEBoxPY_PatchSet self) {
+	return _EBoxPY_PatchSet_Run(self, 0);
+}
+
+static PyObject* EBoxPY_PatchSet_Revert(PEBoxPY_PatchSet self) {
+	return _EBoxPY_PatchSet_Run(self, 1);
+}
+
+static PyObject* EBoxPY_Process_PatchSet(PEBoxPY_Process self) {
 	if (!self->IsOpen_) {
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
 		return NULL;
 	}
-	BOOL status = FALSE;
-	if (!IsWow64Process(self->Process_, &status)) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process Failed to determine if Process is Wow64.");
+	if (self->IsDump_) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsDump_ was True.");
 		return NULL;
 	}
-	if (status) {
-		Py_INCREF(Py_True);
-		return Py_True;
+	PyObject* output = EBoxPY_PatchSet_Type.tp_alloc(&EBoxPY_PatchSet_Type, 1);
+	if (!output)
+		return NULL;
+	EBOXPY_OBJECT_ZERO(EBoxPY_PatchSet, output);
+	Py_INCREF(self);
+	((PEBoxPY_PatchSet)output)->Process_ = (PyObject*)self;
+	return output;
+}
+
+/*
+ *
+ * Global
+ *
+ */
+
+static PyObject* EBoxPY_OpenDump(PyObject* self, PyObject* path) {
+	if (!PyUnicode_Check(path)) {
+		PyErr_SetString(PyExc_TypeError, "EBoxPY.OpenDump requires _Path to be str.");
+		return NULL;
 	}
-	else {
-		Py_INCREF(Py_False);
-		return Py_False;
+	wchar_t* _path = PyUnicode_AsWideCharString(path, NULL);
+	if (!_path)
+		return NULL;
+	_PEBoxPY_Dump dump = NULL;
+	Py_BEGIN_ALLOW_THREADS
+	dump = _EBoxPY_Dump_Open(_path);
+	Py_END_ALLOW_THREADS
+	PyMem_Free(_path);
+	if (!dump) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.OpenDump failed to Open Dump.");
+		return NULL;
+	}
+	PyObject* output = EBoxPY_Process_Type.tp_alloc(&EBoxPY_Process_Type, 1);
+	if (!output) {
+		_EBoxPY_Dump_Close(dump);
+		return NULL;
+	}
+	EBOXPY_OBJECT_ZERO(EBoxPY_Process, output);
+	PEBoxPY_Process process = (PEBoxPY_Process)output;
+	process->ID_ = (unsigned long)dump->Header_->ID_;
+	process->IsOpen_ = 1;
+	process->IsDump_ = 1;
+	process->Dump_ = dump;
+	process->Name_ = PyUnicode_FromWideChar(dump->Header_->Name_, (Py_ssize_t)wcsnlen(dump->Header_->Name_, MAX_PATH));
+	if (!process->Name_) {
+		Py_DECREF(output);
+		return NULL;
 	}
+	return output;
 }
 
-static PyObject* EBoxPY_Process_IsAMD64(PEBoxPY_Process self) {
-	if (!self->IsOpen_) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process.IsOpen_ was False.");
+static PyObject* EBoxPY_GetCurrentProcess(PyObject* self) {
+	wchar_t* path = (wchar_t*)malloc(0x8000 * sizeof(wchar_t));
+	if (!path) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.GetCurrentProcess failed to Allocate path.");
 		return NULL;
 	}
-	BOOL status = FALSE;
-	if (!IsWow64Process(self->Process_, &status)) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.Process Failed to determine if Process is Wow64.");
+	unsigned long length = GetModuleFileNameW(NULL, path, 0x8000);
+	if (!length || length >= 0x8000) {
+		free(path);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.GetCurrentProcess failed to Locate Current Process, GetModuleFileNameW failed.");
 		return NULL;
 	}
-	if (status) {
-		Py_INCREF(Py_False);
-		return Py_False;
-	}
-	else {
-		Py_INCREF(Py_True);
-		return Py_True;
+	const wchar_t* name = path + length;
+	while (name > path && name[-1] != L'\\' && name[-1] != L'/')
+		--name;
+	PyObject* _name = PyUnicode_FromWideChar(name, -1);
+	free(path);
+	if (!_name)
+		return NULL;
+	PyObject* process = _EBoxPY_Create_Process(GetCurrentProcessId(), _name);
+	Py_DECREF(_name);
+	if (!process) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.GetCurrentProcess failed to Create Current Process.");
+		return NULL;
 	}
+	return process;
 }
 
 /*
  *
- * Global
+ * EBoxPY Process Table
  *
  */
 
-static PyObject* EBoxPY_GetCurrentProcess(PyObject* self) {
-	HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
-	if (!snapshot || snapshot == INVALID_HANDLE_VALUE) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.GetCurrentProcess failed to Create Toolhelp32 Snapshot, CreateToolhelp32Snapshot failed.");
-		return NULL;
+typedef struct _EBoxPY_Process_Entry_T {
+	unsigned long ID_;
+	long long CreateTime_;
+	unsigned long Hash_;
+	unsigned long long NameOffset_;
+	unsigned long long NameLength_;
+	PyObject* Name_;
+} _EBoxPY_Process_Entry, *_PEBoxPY_Process_Entry;
+
+// Every Process on the machine, sorted by ID_, with an open addressed index over the Name hashes.
+typedef struct _EBoxPY_Process_Table_T {
+	_PEBoxPY_Process_Entry Entries_;
+	unsigned long long Count_;
+	wchar_t* Names_;
+	unsigned long long* Index_;
+	unsigned long long IndexCapacity_;
+} _EBoxPY_Process_Table, *_PEBoxPY_Process_Table;
+
+static _EBoxPY_Process_Table _EBoxPY_Processes = {0};
+// What RefreshProcesses last reported, GetProcesses and GetProcessesByName refresh the table without moving it.
+static _PEBoxPY_Thread_Record _EBoxPY_Processes_Baseline = NULL;
+static unsigned long long _EBoxPY_Processes_BaselineCount = 0;
+
+static unsigned long _EBoxPY_Process_Table_Hash(const wchar_t* _Name, unsigned long long _Length) {
+	unsigned long hash = 2166136261UL;
+	for (unsigned long long i = 0; i < _Length; ++i) {
+		hash ^= (unsigned long)_Name[i];
+		hash *= 16777619UL;
 	}
-	PROCESSENTRY32W entry = {0};
-	entry.dwSize = sizeof(PROCESSENTRY32W);
-	for (BOOL b = Process32FirstW(snapshot, &entry); b == TRUE; b = Process32NextW(snapshot, &entry)) {
-		if (entry.th32ProcessID == GetCurrentProcessId()) {
-			PyObject* process = _EBoxPY_Create_Process(entry);
-			CloseHandle(snapshot);
-			if (!process) {
-				PyErr_SetString(PyExc_RuntimeError, "EBoxPY.GetCurrentProcess failed to Create Current Process.");
-				return NULL;
-			}
-			else {
-				return process;
-			}
+	return hash;
+}
+
+static int _EBoxPY_Process_Entry_Compare(const void* _Left, const void* _Right) {
+	unsigned long left = ((const _EBoxPY_Process_Entry*)_Left)->ID_;
+	unsigned long right = ((const _EBoxPY_Process_Entry*)_Right)->ID_;
+	return (left > right) - (left < right);
+}
+
+static _PEBoxPY_Process_Entry _EBoxPY_Process_Table_Find(_PEBoxPY_Process_Table _Table, unsigned long _ID) {
+	unsigned long long low = 0;
+	unsigned long long high = _Table->Count_;
+	while (low < high) {
+		unsigned long long middle = low + (high - low) / 2;
+		if (_Table->Entries_[middle].ID_ < _ID)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	if (low < _Table->Count_ && _Table->Entries_[low].ID_ == _ID)
+		return &_Table->Entries_[low];
+	return NULL;
+}
+
+static PyObject* _EBoxPY_Process_Table_Name(_PEBoxPY_Process_Table _Table, _PEBoxPY_Process_Entry _Entry) {
+	if (!_Entry->Name_)
+		_Entry->Name_ = PyUnicode_FromWideChar(_Table->Names_ + _Entry->NameOffset_, (Py_ssize_t)_Entry->NameLength_);
+	return _Entry->Name_;
+}
+
+// Rebuilds the table from a fresh system query, entries whose ID_ and CreateTime_ survive keep their Name string.
+static int _EBoxPY_Process_Table_Refresh(void) {
+	_PEBoxPY_Process_Table table = &_EBoxPY_Processes;
+	_PEBoxPY_System_Process buffer = NULL;
+	Py_BEGIN_ALLOW_THREADS
+	buffer = _EBoxPY_System_Query();
+	Py_END_ALLOW_THREADS
+	if (!buffer) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY failed to Query Processes, NtQuerySystemInformation failed.");
+		return 0;
+	}
+	static const wchar_t idle[] = L"[System Process]";
+	unsigned long long count = 0;
+	unsigned long long characters = 0;
+	for (_PEBoxPY_System_Process i = buffer; i; i = _EBoxPY_System_Next(i)) {
+		++count;
+		characters += (i->Name_ ? i->NameLength_ / sizeof(wchar_t) : sizeof(idle) / sizeof(wchar_t));
+	}
+	_EBoxPY_Process_Table next = {0};
+	next.Entries_ = (_PEBoxPY_Process_Entry)calloc((size_t)count + 1, sizeof(_EBoxPY_Process_Entry));
+	next.Names_ = (wchar_t*)malloc(((size_t)characters + 1) * sizeof(wchar_t));
+	next.IndexCapacity_ = 64;
+	while (next.IndexCapacity_ < count * 2)
+		next.IndexCapacity_ <<= 1;
+	next.Index_ = (unsigned long long*)calloc((size_t)next.IndexCapacity_, sizeof(unsigned long long));
+	if (!next.Entries_ || !next.Names_ || !next.Index_) {
+		free(buffer);
+		free(next.Entries_);
+		free(next.Names_);
+		free(next.Index_);
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY failed to Allocate the Process table.");
+		return 0;
+	}
+	unsigned long long offset = 0;
+	for (_PEBoxPY_System_Process i = buffer; i; i = _EBoxPY_System_Next(i)) {
+		_PEBoxPY_Process_Entry entry = &next.Entries_[next.Count_++];
+		const wchar_t* name = (i->Name_ ? i->Name_ : idle);
+		entry->ID_ = (unsigned long)(ULONG_PTR)i->UniqueProcessId_;
+		entry->CreateTime_ = i->CreateTime_;
+		entry->NameOffset_ = offset;
+		entry->NameLength_ = (i->Name_ ? i->NameLength_ / sizeof(wchar_t) : sizeof(idle) / sizeof(wchar_t) - 1);
+		entry->Hash_ = _EBoxPY_Process_Table_Hash(name, entry->NameLength_);
+		memcpy(next.Names_ + offset, name, (size_t)entry->NameLength_ * sizeof(wchar_t));
+		offset += entry->NameLength_;
+		_PEBoxPY_Process_Entry previous = _EBoxPY_Process_Table_Find(table, entry->ID_);
+		if (previous && previous->CreateTime_ == entry->CreateTime_) {
+			entry->Name_ = previous->Name_;
+			previous->Name_ = NULL;
 		}
 	}
-	CloseHandle(snapshot);
-	PyErr_SetString(PyExc_RuntimeError, "EBoxPY.GetCurrentProcess failed to Locate Current Process.");
-	return NULL;
+	free(buffer);
+	qsort(next.Entries_, (size_t)next.Count_, sizeof(_EBoxPY_Process_Entry), _EBoxPY_Process_Entry_Compare);
+	for (unsigned long long i = 0; i < next.Count_; ++i) {
+		unsigned long long slot = next.Entries_[i].Hash_ & (next.IndexCapacity_ - 1);
+		while (next.Index_[slot])
+			slot = (slot + 1) & (next.IndexCapacity_ - 1);
+		next.Index_[slot] = i + 1;
+	}
+	for (unsigned long long i = 0; i < table->Count_; ++i)
+		Py_XDECREF(table->Entries_[i].Name_);
+	free(table->Entries_);
+	free(table->Names_);
+	free(table->Index_);
+	*table = next;
+	return 1;
 }
 
 static PyObject* EBoxPY_GetProcesses(PyObject* self) {
-	HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
-	if (!snapshot || snapshot == INVALID_HANDLE_VALUE) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.GetProcesses failed to Create Toolhelp32 Snapshot, CreateToolhelp32Snapshot failed.");
+	if (!_EBoxPY_Process_Table_Refresh())
 		return NULL;
-	}
-	PROCESSENTRY32W entry = {0};
-	entry.dwSize = sizeof(PROCESSENTRY32W);
+	_PEBoxPY_Process_Table table = &_EBoxPY_Processes;
 	PyObject* list = PyList_New(0);
 	if (!list) {
-		CloseHandle(snapshot);
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.GetProcesses failed to Create List.");
 		return NULL;
 	}
-	for (BOOL b = Process32FirstW(snapshot, &entry); b == TRUE; b = Process32NextW(snapshot, &entry)) {
-		PyObject* process = _EBoxPY_Create_Process(entry);
+	for (unsigned long long i = 0; i < table->Count_; ++i) {
+		PyObject* name = _EBoxPY_Process_Table_Name(table, &table->Entries_[i]);
+		PyObject* process = (name ? _EBoxPY_Create_Process(table->Entries_[i].ID_, name) : NULL);
 		if (process) {
 			PyList_Append(list, process);
 			Py_DECREF(process);
 		}
+		else {
+			PyErr_Clear();
+		}
 	}
-	CloseHandle(snapshot);
 	return list;
 }
 
@@ -1826,35 +10202,78 @@ static PyObject* EBoxPY_GetProcessesByName(PyObject* self, PyObject* key) {
 		PyErr_SetString(PyExc_TypeError, "EBoxPY.GetProcesses requires _Name to be of type string.");
 		return NULL;
 	}
-	HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
-	if (!snapshot || snapshot == INVALID_HANDLE_VALUE) {
-		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.GetProcesses failed to Create Toolhelp32 Snapshot, CreateToolhelp32Snapshot failed.");
+	Py_ssize_t length = 0;
+	wchar_t* name = PyUnicode_AsWideCharString(key, &length);
+	if (!name)
+		return NULL;
+	if (!_EBoxPY_Process_Table_Refresh()) {
+		PyMem_Free(name);
 		return NULL;
 	}
-	PROCESSENTRY32W entry = {0};
-	entry.dwSize = sizeof(PROCESSENTRY32W);
+	_PEBoxPY_Process_Table table = &_EBoxPY_Processes;
 	PyObject* list = PyList_New(0);
 	if (!list) {
-		CloseHandle(snapshot);
+		PyMem_Free(name);
 		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.GetProcesses failed to Create List.");
 		return NULL;
 	}
-	for (BOOL b = Process32FirstW(snapshot, &entry); b == TRUE; b = Process32NextW(snapshot, &entry)) {
-		PyObject* process = _EBoxPY_Create_Process(entry);
+	// Only the matching entries ever become Python objects.
+	unsigned long hash = _EBoxPY_Process_Table_Hash(name, (unsigned long long)length);
+	for (unsigned long long slot = hash & (table->IndexCapacity_ - 1); table->Index_[slot]; slot = (slot + 1) & (table->IndexCapacity_ - 1)) {
+		_PEBoxPY_Process_Entry entry = &table->Entries_[table->Index_[slot] - 1];
+		if (entry->Hash_ != hash || entry->NameLength_ != (unsigned long long)length || memcmp(table->Names_ + entry->NameOffset_, name, (size_t)length * sizeof(wchar_t)))
+			continue;
+		PyObject* _name = _EBoxPY_Process_Table_Name(table, entry);
+		PyObject* process = (_name ? _EBoxPY_Create_Process(entry->ID_, _name) : NULL);
 		if (process) {
-			if (PyUnicode_Compare(((PEBoxPY_Process)process)->Name_, key) == 0)
-				PyList_Append(list, process);
+			PyList_Append(list, process);
 			Py_DECREF(process);
 		}
+		else {
+			PyErr_Clear();
+		}
 	}
-	CloseHandle(snapshot);
+	PyMem_Free(name);
 	return list;
 }
 
+static PyObject* EBoxPY_RefreshProcesses(PyObject* self) {
+	if (!_EBoxPY_Process_Table_Refresh())
+		return NULL;
+	_PEBoxPY_Process_Table table = &_EBoxPY_Processes;
+	_PEBoxPY_Thread_Record records = (_PEBoxPY_Thread_Record)malloc(((size_t)table->Count_ + 1) * sizeof(_EBoxPY_Thread_Record));
+	if (!records) {
+		PyErr_SetString(PyExc_RuntimeError, "EBoxPY.RefreshProcesses failed to Allocate the baseline.");
+		return NULL;
+	}
+	for (unsigned long long i = 0; i < table->Count_; ++i) {
+		records[i].ID_ = table->Entries_[i].ID_;
+		records[i].CreateTime_ = table->Entries_[i].CreateTime_;
+	}
+	// The baseline only moves once both lists are complete, a failure reports the same changes next time.
+	PyObject* created = PyList_New(0);
+	PyObject* exited = PyList_New(0);
+	if (!created || !exited || !_EBoxPY_Diff_Records(_EBoxPY_Processes_Baseline, _EBoxPY_Processes_BaselineCount, records, table->Count_, created, exited)) {
+		free(records);
+		Py_XDECREF(created);
+		Py_XDECREF(exited);
+		return NULL;
+	}
+	free(_EBoxPY_Processes_Baseline);
+	_EBoxPY_Processes_Baseline = records;
+	_EBoxPY_Processes_BaselineCount = table->Count_;
+	PyObject* output = PyTuple_Pack(2, created, exited);
+	Py_DECREF(created);
+	Py_DECREF(exited);
+	return output;
+}
+
 static PyMethodDef EBoxPY_Global_Methods[] = {
 	{"GetCurrentProcess", (PyCFunction)EBoxPY_GetCurrentProcess, METH_NOARGS, PyDoc_STR("EBoxPY.GetCurrentProcess() -> EBoxPY.Process(...)\n.")},
 	{"GetProcesses", (PyCFunction)EBoxPY_GetProcesses, METH_NOARGS, PyDoc_STR("EBoxPY.GetProcesses() -> [EBoxPY.Process(...), ...]\nRetrieves a list of Processes, the Processes are not yet Opened.")},
+	{"RefreshProcesses", (PyCFunction)EBoxPY_RefreshProcesses, METH_NOARGS, PyDoc_STR("EBoxPY.RefreshProcesses() -> ([ ID, ... ], [ ID, ... ])\nUpdates the cached Process table, returns the IDs of the Processes started and exited since the last RefreshProcesses.")},
 	{"GetProcessesByName", (PyCFunction)EBoxPY_GetProcessesByName, METH_O, PyDoc_STR("EBoxPY.GetProcessesByName(_Name) -> [EBoxPY.Process(...), ...]\nRetrieves a list of Processes with EBoxPY.Process.Name_ == _Name, the Processes are not yet Opened.")},
+	{"OpenDump", (PyCFunction)EBoxPY_OpenDump, METH_O, PyDoc_STR("EBoxPY.OpenDump(_Path) -> EBoxPY.Process\nOpens a file written by EBoxPY.Process.Dump as an offline Process, Reads and Regions are served from the Dump.")},
 	{"StartProcess", (PyCFunction)EBoxPY_StartProcess, METH_VARARGS, PyDoc_STR("EBoxPY.StartProcess(_Executable, _Suspended) -> EBoxPY.Process\nLaunches a new Process.")},
 	{NULL}
 };
@@ -1880,5 +10299,13 @@ PyMODINIT_FUNC PyInit_EBoxPY(void) {
 	_EBoxPY_Initialize_Bytes(_module);
 	_EBoxPY_Initialize_Thread(_module);
 	_EBoxPY_Initialize_Process(_module);
+	_EBoxPY_Initialize_Snapshot(_module);
+	_EBoxPY_Initialize_Async(_module);
+	_EBoxPY_Initialize_Watch(_module);
+	_EBoxPY_Initialize_Arena(_module);
+	_EBoxPY_Initialize_Debugger(_module);
+	_EBoxPY_Initialize_Spec(_module);
+	_EBoxPY_Initialize_Stream(_module);
+	_EBoxPY_Initialize_PatchSet(_module);
 	return _module;
 }
\ No newline at end of file